@@ -13,13 +13,14 @@ public class PoolManager : ModuleRules
 			{
 				"Core"
 				, "DeveloperSettings" // Created UPoolManagerSettings
+				, "UMG" // Created UPoolFactory_UserWidget, UPooledListView
 			}
 		);
 
 		PrivateDependencyModuleNames.AddRange(new[]
 			{
 				"CoreUObject", "Engine", "Slate", "SlateCore" // Core
-				, "UMG" // Created UPoolFactory_UserWidget
+				, "TraceLog" // PoolManagerChannel
 			}
 		);
 
@@ -0,0 +1,37 @@
+// Copyright (c) Yevhenii Selivanov
+
+#include "Data/PoolBatchTickFunction.h"
+
+// Pool Manager
+#include "PoolManagerSubsystem.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PoolBatchTickFunction)
+
+// Default constructor
+FPoolBatchTickFunction::FPoolBatchTickFunction()
+{
+	bCanEverTick = true;
+	bStartWithTickEnabled = true;
+	TickGroup = TG_PrePhysics;
+}
+
+// Is overridden to tick all batched pools of the Pool Manager
+void FPoolBatchTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (TickType == LEVELTICK_ViewportsOnly)
+	{
+		// Do not tick pool objects when the world is not simulated
+		return;
+	}
+
+	if (UPoolManagerSubsystem* PoolManagerPtr = PoolManager.Get())
+	{
+		PoolManagerPtr->TickBatchedPools(DeltaTime);
+	}
+}
+
+// Is overridden to describe this tick function in debug messages
+FString FPoolBatchTickFunction::DiagnosticMessage()
+{
+	return FString::Printf(TEXT("FPoolBatchTickFunction[%s]"), *GetNameSafe(PoolManager.Get()));
+}
@@ -31,7 +31,8 @@ FPoolObjectData* FPoolContainer::FindInPool(const FPoolObjectHandle& Handle)
 		return nullptr;
 	}
 
-	return PoolObjects.FindByKey(Handle);
+	// The reserved handle is checked as well, since it is the alias of the own handle while the object is taken
+	return PoolObjects.FindByPredicate([&Handle](const FPoolObjectData& It) { return It.Handle == Handle || It.ReservedHandle == Handle; });
 }
 
 // Returns factory or crashes as critical error if it is not set
@@ -7,6 +7,42 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(PoolManagerSettings)
 
+// Returns true if properties of returned objects of given class have to be reset to their defaults
+bool UPoolManagerSettings::ShouldResetPropertiesOnReturn(const UClass* ObjectClass) const
+{
+	if (!ObjectClass)
+	{
+		return false;
+	}
+
+	for (const TSoftClassPtr<UObject>& It : ResetPropertiesOnReturnClasses)
+	{
+		// Parent class is always loaded if its child is loaded, so there is no need to load it
+		const UClass* ResetClass = It.Get();
+		if (ResetClass && ObjectClass->IsChildOf(ResetClass))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// Returns how many seconds objects of given class can stay taken before they are reported as suspected leaks
+float UPoolManagerSettings::GetLeakThreshold(const UClass* ObjectClass) const
+{
+	// Find the most derived overridden class
+	for (const UClass* ClassIt = ObjectClass; ClassIt; ClassIt = ClassIt->GetSuperClass())
+	{
+		if (const float* Threshold = LeakThresholds.Find(TSoftClassPtr<UObject>(ClassIt)))
+		{
+			return *Threshold;
+		}
+	}
+
+	return DefaultLeakThreshold;
+}
+
 // Returns all Pool Factories that will be used by the Pool Manager
 void UPoolManagerSettings::GetPoolFactories(TArray<UClass*>& OutBlueprintPoolFactories) const
 {
@@ -34,5 +34,10 @@ FPoolObjectData::FPoolObjectData(UObject* InPoolObject)
 // Returns the state of the object in the pool
 EPoolObjectState FPoolObjectData::GetState() const
 {
-	return bIsActive ? EPoolObjectState::Active : EPoolObjectState::Inactive;
+	if (bIsActive)
+	{
+		return EPoolObjectState::Active;
+	}
+
+	return bIsCold ? EPoolObjectState::Cold : EPoolObjectState::Inactive;
 }
@@ -0,0 +1,88 @@
+// Copyright (c) Yevhenii Selivanov
+
+#include "Data/PoolSpawnLatency.h"
+
+// Returns the index of the first bucket where the accumulated number of samples reaches given percent
+template <int32 BucketsNum>
+static int32 FindPercentileBucket(const TStaticArray<int32, BucketsNum>& Buckets, int32 SamplesNum, float Percentile)
+{
+	const int32 TargetNum = FMath::Max(1, FMath::CeilToInt32(SamplesNum * FMath::Clamp(Percentile, 0.f, 100.f) / 100.f));
+
+	int32 AccumulatedNum = 0;
+	for (int32 Index = 0; Index < BucketsNum; ++Index)
+	{
+		AccumulatedNum += Buckets[Index];
+		if (AccumulatedNum >= TargetNum)
+		{
+			return Index;
+		}
+	}
+	return BucketsNum - 1;
+}
+
+// Records the latency of one spawn
+void FPoolSpawnLatencyHistogram::Add(int32 LatencyFrames, double LatencyMs)
+{
+	LatencyFrames = FMath::Max(LatencyFrames, 0);
+	LatencyMs = FMath::Max(LatencyMs, 0.0);
+
+	++FramesBuckets[FMath::Min(LatencyFrames, FramesBucketsNum - 1)];
+
+	// Bucket 0 is [0, 1) ms, bucket N is [2^(N-1), 2^N) ms
+	const int32 MsBucket = LatencyMs < 1.0 ? 0 : FMath::FloorLog2(static_cast<uint32>(FMath::Min(LatencyMs, static_cast<double>(MAX_int32)))) + 1;
+	++MsBuckets[FMath::Min(MsBucket, MsBucketsNum - 1)];
+
+	++SamplesNum;
+	TotalMs += LatencyMs;
+	MaxMs = FMath::Max(MaxMs, LatencyMs);
+	MaxFrames = FMath::Max(MaxFrames, LatencyFrames);
+}
+
+// Merges given histogram into this one
+void FPoolSpawnLatencyHistogram::Append(const FPoolSpawnLatencyHistogram& Other)
+{
+	for (int32 Index = 0; Index < FramesBucketsNum; ++Index)
+	{
+		FramesBuckets[Index] += Other.FramesBuckets[Index];
+	}
+
+	for (int32 Index = 0; Index < MsBucketsNum; ++Index)
+	{
+		MsBuckets[Index] += Other.MsBuckets[Index];
+	}
+
+	SamplesNum += Other.SamplesNum;
+	TotalMs += Other.TotalMs;
+	MaxMs = FMath::Max(MaxMs, Other.MaxMs);
+	MaxFrames = FMath::Max(MaxFrames, Other.MaxFrames);
+}
+
+// Returns the latency in frames that is not exceeded by given percent of spawns
+int32 FPoolSpawnLatencyHistogram::GetPercentileFrames(float Percentile) const
+{
+	if (SamplesNum <= 0)
+	{
+		return 0;
+	}
+
+	const int32 BucketIndex = FindPercentileBucket(FramesBuckets, SamplesNum, Percentile);
+	return BucketIndex == FramesBucketsNum - 1 ? MaxFrames : BucketIndex;
+}
+
+// Returns the upper bound of the latency in milliseconds that is not exceeded by given percent of spawns
+double FPoolSpawnLatencyHistogram::GetPercentileMs(float Percentile) const
+{
+	if (SamplesNum <= 0)
+	{
+		return 0.0;
+	}
+
+	const int32 BucketIndex = FindPercentileBucket(MsBuckets, SamplesNum, Percentile);
+	return FMath::Min(GetMsBucketUpperBound(BucketIndex), MaxMs);
+}
+
+// Returns the upper bound in milliseconds of given bucket
+double FPoolSpawnLatencyHistogram::GetMsBucketUpperBound(int32 BucketIndex) const
+{
+	return BucketIndex >= MsBucketsNum - 1 ? MaxMs : static_cast<double>(1 << BucketIndex);
+}
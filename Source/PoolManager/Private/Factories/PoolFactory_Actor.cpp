@@ -3,11 +3,13 @@
 #include "Factories/PoolFactory_Actor.h"
 
 // Pool Manager
+#include "PoolObjectBatchTick.h"
 #include "Data/PoolObjectData.h"
 #include "Data/PoolObjectState.h"
 #include "Data/TakeFromPoolPayload.h"
 
 // UE
+#include "Algo/Count.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
 
@@ -40,7 +42,16 @@ UObject* UPoolFactory_Actor::SpawnNow_Implementation(const FSpawnRequest& Reques
 	SpawnParameters.bCreateActorPackage = false; // Do not bake this runtime actor into World Partition level
 #endif
 
-	return World->SpawnActor(Request.GetClassChecked<AActor>(), &Request.Transform, SpawnParameters);
+	UClass* ActorClass = Request.GetClassChecked<AActor>();
+	if (AActor* Template = Cast<AActor>(FindSpawnTemplate(ActorClass)))
+	{
+		// Copy configured template instead of the class default object and skip generating unique name
+		SpawnParameters.Template = Template;
+		SpawnParameters.Name = MakeSpawnName(ActorClass);
+		SpawnParameters.NameMode = FActorSpawnParameters::ESpawnActorNameMode::Requested;
+	}
+
+	return World->SpawnActor(ActorClass, &Request.Transform, SpawnParameters);
 }
 
 // Is overridden to finish spawning the actor since it was deferred
@@ -49,7 +60,137 @@ void UPoolFactory_Actor::OnPreRegistered(const FSpawnRequest& Request, const FPo
 	Super::OnPreRegistered(Request, ObjectData);
 
 	AActor& SpawnedActor = ObjectData.GetChecked<AActor>();
-	SpawnedActor.FinishSpawning(Request.Transform);
+	if (!SpawnedActor.IsActorInitialized())
+	{
+		// Was not finished on previous stage
+		SpawnedActor.FinishSpawning(Request.Transform);
+	}
+}
+
+// Is overridden to cancel actors that are spawned across multiple frames
+bool UPoolFactory_Actor::DequeueSpawnRequestByHandle(const FPoolObjectHandle& Handle, FSpawnRequest& OutRequest)
+{
+	const int32 Idx = DeferredSpawns.IndexOfByPredicate([&Handle](const FPoolDeferredActorSpawn& It)
+	{
+		return It.Request.Handle == Handle;
+	});
+
+	if (!DeferredSpawns.IsValidIndex(Idx))
+	{
+		return Super::DequeueSpawnRequestByHandle(Handle, OutRequest);
+	}
+
+	// Actor is already spawned, but not registered yet, so destroy it the same way as objects constructed on worker threads
+	const FPoolDeferredActorSpawn Deferred = DeferredSpawns[Idx];
+	DeferredSpawns.RemoveAt(Idx);
+	OutRequest = Deferred.Request;
+
+	if (IsValid(Deferred.Actor))
+	{
+		Destroy(Deferred.Actor);
+	}
+
+	return OutRequest.IsValid();
+}
+
+// Is overridden to take into account actors that are spawned across multiple frames
+int32 UPoolFactory_Actor::GetSpawnQueueNum(const UClass* ObjectClass /* = nullptr*/) const
+{
+	const int32 DeferredNum = ObjectClass
+		                          ? Algo::CountIf(DeferredSpawns, [ObjectClass](const FPoolDeferredActorSpawn& It) { return It.Request.GetClass() == ObjectClass; })
+		                          : DeferredSpawns.Num();
+	return Super::GetSpawnQueueNum(ObjectClass) + DeferredNum;
+}
+
+// Is overridden to take into account actors that are spawned across multiple frames
+int32 UPoolFactory_Actor::GetSpawnQueueNumByPriority(ESpawnRequestPriority Priority) const
+{
+	const int32 DeferredNum = Algo::CountIf(DeferredSpawns, [Priority](const FPoolDeferredActorSpawn& It) { return It.Request.Priority == Priority; });
+	return Super::GetSpawnQueueNumByPriority(Priority) + DeferredNum;
+}
+
+// Is overridden to continue spawning of non-critical actors on next frames instead of registering them right away
+void UPoolFactory_Actor::ProcessSpawnedObject(const FSpawnRequest& Request, UObject& CreatedObject)
+{
+	if (!bSplitSpawnAcrossFrames
+	    || Request.Priority == ESpawnRequestPriority::Critical)
+	{
+		Super::ProcessSpawnedObject(Request, CreatedObject);
+		return;
+	}
+
+	FPoolDeferredActorSpawn& Deferred = DeferredSpawns.AddDefaulted_GetRef();
+	Deferred.Request = Request;
+	Deferred.Actor = CastChecked<AActor>(&CreatedObject);
+}
+
+// Is overridden to finish construction or register actors that are spawned across multiple frames
+int32 UPoolFactory_Actor::ProcessDeferredSpawnStages(int32 Budget)
+{
+	int32 UsedBudget = Super::ProcessDeferredSpawnStages(Budget);
+
+	// Copy handles since stages run user code (BeginPlay, callbacks) that can spawn or cancel other actors
+	// Only construction is charged against the budget, while registration of constructed actors is cheap, so all of them are registered
+	TArray<FPoolObjectHandle> Handles;
+	Handles.Reserve(DeferredSpawns.Num());
+	int32 ConstructionsNum = 0;
+	for (const FPoolDeferredActorSpawn& It : DeferredSpawns)
+	{
+		if (!It.bIsConstructed)
+		{
+			if (ConstructionsNum >= Budget - UsedBudget)
+			{
+				continue;
+			}
+			++ConstructionsNum;
+		}
+		Handles.Emplace(It.Request.Handle);
+	}
+
+	for (const FPoolObjectHandle& HandleIt : Handles)
+	{
+		const int32 Idx = DeferredSpawns.IndexOfByPredicate([&HandleIt](const FPoolDeferredActorSpawn& It)
+		{
+			return It.Request.Handle == HandleIt;
+		});
+
+		if (!DeferredSpawns.IsValidIndex(Idx))
+		{
+			// Was cancelled by previous stage
+			continue;
+		}
+
+		FPoolDeferredActorSpawn& Deferred = DeferredSpawns[Idx];
+		AActor* Actor = Deferred.Actor;
+		if (!IsValid(Actor))
+		{
+			// Actor was destroyed outside, e.g: its level was unloaded
+			DeferredSpawns.RemoveAt(Idx);
+			continue;
+		}
+
+		if (!Deferred.bIsConstructed)
+		{
+			// --- Stage: run construction script and BeginPlay, keep the actor deactivated until it is registered
+			++UsedBudget;
+			Deferred.bIsConstructed = true;
+			const FTransform Transform = Deferred.Request.Transform;
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			Actor->FinishSpawning(Transform);
+			OnChangedStateInPool(EPoolObjectState::Inactive, Actor);
+
+			// The most expensive part of the spawn is here, since the actor itself was already created by the spawn stage
+			RecordSpawnHitch(Actor->GetClass(), FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles));
+			continue;
+		}
+
+		// --- Stage: register in the pool and notify listeners
+		const FSpawnRequest Request = Deferred.Request;
+		DeferredSpawns.RemoveAt(Idx);
+		Super::ProcessSpawnedObject(Request, *Actor);
+	}
+
+	return UsedBudget;
 }
 
 /*********************************************************************************************
@@ -100,8 +241,26 @@ void UPoolFactory_Actor::OnChangedStateInPool_Implementation(EPoolObjectState Ne
 
 	AActor* Actor = CastChecked<AActor>(InObject);
 	const bool bActivate = NewState == EPoolObjectState::Active;
+	const bool bIsCold = NewState == EPoolObjectState::Cold;
+
+	if (!bIsCold
+	    && Actor->IsActorInitialized() // Just spawned actors register their components on finishing spawning
+	    && !Actor->HasActorRegisteredAllComponents())
+	{
+		// Is promoted from the cold tier, restore its render and physics state
+		Actor->RegisterAllComponents();
+	}
 
 	Actor->SetActorHiddenInGame(!bActivate);
 	Actor->SetActorEnableCollision(bActivate);
-	Actor->SetActorTickEnabled(bActivate);
+
+	// Actors of batched pools are ticked all at once by the Pool Manager, so never enable their own tick
+	const bool bIsBatchTicked = Actor->Implements<UPoolObjectBatchTick>();
+	Actor->SetActorTickEnabled(bActivate && !bIsBatchTicked);
+
+	if (bIsCold && Actor->HasActorRegisteredAllComponents())
+	{
+		// Release render and physics state of cold actors, they are registered back once promoted or taken
+		Actor->UnregisterAllComponents();
+	}
 }
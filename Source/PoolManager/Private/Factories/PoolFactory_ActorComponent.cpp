@@ -0,0 +1,148 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Factories/PoolFactory_ActorComponent.h"
+
+// Pool Manager
+#include "PoolObjectBatchTick.h"
+#include "Data/PoolObjectState.h"
+
+// UE
+#include "Components/ActorComponent.h"
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PoolFactory_ActorComponent)
+
+// Is overridden to handle ActorComponent-inherited classes
+const UClass* UPoolFactory_ActorComponent::GetObjectClass_Implementation() const
+{
+	return UActorComponent::StaticClass();
+}
+
+/*********************************************************************************************
+ * Creation
+ ********************************************************************************************* */
+
+// Is overridden to create the component in the host actor and register it
+UObject* UPoolFactory_ActorComponent::SpawnNow_Implementation(const FSpawnRequest& Request)
+{
+	// Super is not called to create the component in the host actor instead of the factory outer
+
+	AActor& Host = GetHostActorChecked();
+	UClass* ComponentClass = Request.GetClassChecked<UActorComponent>();
+	UObject* Template = FindSpawnTemplate(ComponentClass);
+	UActorComponent* Component = Template
+		                             ? NewObject<UActorComponent>(&Host, ComponentClass, MakeSpawnName(ComponentClass), RF_NoFlags, Template)
+		                             : NewObject<UActorComponent>(&Host, ComponentClass);
+	Component->RegisterComponent();
+	return Component;
+}
+
+/*********************************************************************************************
+ * Destruction
+ ********************************************************************************************* */
+
+// Is overridden to destroy given component using its engine's Destroy Component method
+void UPoolFactory_ActorComponent::Destroy_Implementation(UObject* Object)
+{
+	// Super is not called to Destroy Component instead of ConditionalBeginDestroy
+
+	UActorComponent* Component = CastChecked<UActorComponent>(Object);
+	checkf(IsValid(Component), TEXT("ERROR: [%i] %hs:\n'IsValid(Component)' is null!"), __LINE__, __FUNCTION__);
+	Component->DestroyComponent();
+}
+
+/*********************************************************************************************
+ * Pool
+ ********************************************************************************************* */
+
+// Is overridden to change activation and ticking according new state
+void UPoolFactory_ActorComponent::OnChangedStateInPool_Implementation(EPoolObjectState NewState, UObject* InObject)
+{
+	Super::OnChangedStateInPool_Implementation(NewState, InObject);
+
+	UActorComponent* Component = CastChecked<UActorComponent>(InObject);
+	const bool bActivate = NewState == EPoolObjectState::Active;
+	const bool bIsCold = NewState == EPoolObjectState::Cold;
+
+	if (!bIsCold && !Component->IsRegistered())
+	{
+		// Is promoted from the cold tier, restore its render and physics state
+		Component->RegisterComponent();
+	}
+
+	if (bActivate)
+	{
+		Component->Activate(/*bReset*/ true);
+	}
+	else
+	{
+		Component->Deactivate();
+	}
+
+	// Components of batched pools are ticked all at once by the Pool Manager, so never enable their own tick
+	const bool bIsBatchTicked = Component->Implements<UPoolObjectBatchTick>();
+	Component->SetComponentTickEnabled(bActivate && !bIsBatchTicked);
+
+	if (bIsCold && Component->IsRegistered())
+	{
+		// Release render and physics state of cold components, they are registered back once promoted or taken
+		Component->UnregisterComponent();
+	}
+}
+
+/*********************************************************************************************
+ * Host Actor
+ ********************************************************************************************* */
+
+// Returns the actor that owns all pooled components of this factory, is spawned on first request
+AActor* UPoolFactory_ActorComponent::GetHostActor()
+{
+	if (!IsValid(HostActor))
+	{
+		HostActor = SpawnHostActor();
+	}
+
+	return HostActor;
+}
+
+AActor& UPoolFactory_ActorComponent::GetHostActorChecked()
+{
+	AActor* Host = GetHostActor();
+	checkf(Host, TEXT("ERROR: [%i] %hs:\n'Host' is null!"), __LINE__, __FUNCTION__);
+	return *Host;
+}
+
+// Spawns transient actor with the scene root in the Persistent level, is used to own pooled components and instances
+AActor* UPoolFactory_ActorComponent::SpawnTransientHostActor(UWorld& World, FName BaseName)
+{
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.Name = MakeUniqueObjectName(World.PersistentLevel, AActor::StaticClass(), BaseName);
+	SpawnParameters.OverrideLevel = World.PersistentLevel; // Always keep the host on Persistent level
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParameters.ObjectFlags |= RF_Transient;
+	SpawnParameters.bNoFail = true;
+#if WITH_EDITORONLY_DATA
+	SpawnParameters.bCreateActorPackage = false; // Do not bake this runtime actor into World Partition level
+#endif
+
+	AActor* NewHost = World.SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParameters);
+	checkf(NewHost, TEXT("ERROR: [%i] %hs:\n'NewHost' failed to spawn!"), __LINE__, __FUNCTION__);
+
+	// Plain actor has no root, so create it to let scene components be attached
+	USceneComponent* RootComponent = NewObject<USceneComponent>(NewHost, TEXT("Root"));
+	NewHost->SetRootComponent(RootComponent);
+	RootComponent->RegisterComponent();
+
+	return NewHost;
+}
+
+// Spawns new host actor for pooled components
+AActor* UPoolFactory_ActorComponent::SpawnHostActor_Implementation()
+{
+	UWorld* World = GetWorld();
+	checkf(World, TEXT("ERROR: [%i] %hs:\n'World' is null!"), __LINE__, __FUNCTION__);
+
+	return SpawnTransientHostActor(*World, TEXT("PoolComponentsHost"));
+}
@@ -0,0 +1,141 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Factories/PoolFactory_InstancedMesh.h"
+
+// Pool Manager
+#include "PoolInstancedMeshProxy.h"
+#include "Data/PoolObjectState.h"
+#include "Data/TakeFromPoolPayload.h"
+#include "Factories/PoolFactory_ActorComponent.h"
+
+// UE
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PoolFactory_InstancedMesh)
+
+// Is overridden to handle Instanced Mesh Proxy-inherited classes
+const UClass* UPoolFactory_InstancedMesh::GetObjectClass_Implementation() const
+{
+	return UPoolInstancedMeshProxy::StaticClass();
+}
+
+/*********************************************************************************************
+ * Creation
+ ********************************************************************************************* */
+
+// Is overridden to create the proxy and add or reuse its instance in the shared component
+UObject* UPoolFactory_InstancedMesh::SpawnNow_Implementation(const FSpawnRequest& Request)
+{
+	UPoolInstancedMeshProxy* Proxy = CastChecked<UPoolInstancedMeshProxy>(Super::SpawnNow_Implementation(Request));
+	UClass* ProxyClass = Proxy->GetClass();
+
+	UInstancedStaticMeshComponent* InstancedMesh = FindOrAddInstancedMesh(ProxyClass);
+	checkf(InstancedMesh, TEXT("ERROR: [%i] %hs:\n'InstancedMesh' is null for %s!"), __LINE__, __FUNCTION__, *ProxyClass->GetName());
+
+	int32 InstanceIndex = INDEX_NONE;
+	TArray<int32>* RecycledIndices = RecycledInstances.Find(ProxyClass);
+	if (RecycledIndices && !RecycledIndices->IsEmpty())
+	{
+		InstanceIndex = RecycledIndices->Pop(EAllowShrinking::No);
+		InstancedMesh->UpdateInstanceTransform(InstanceIndex, Request.Transform, /*bWorldSpace*/ true, /*bMarkRenderStateDirty*/ true, /*bTeleport*/ true);
+	}
+	else
+	{
+		InstanceIndex = InstancedMesh->AddInstance(Request.Transform, /*bWorldSpace*/ true);
+	}
+
+	Proxy->InstancedMeshComponent = InstancedMesh;
+	Proxy->InstanceIndex = InstanceIndex;
+	return Proxy;
+}
+
+/*********************************************************************************************
+ * Destruction
+ ********************************************************************************************* */
+
+// Is overridden to hide the instance and recycle its slot instead of removing it
+void UPoolFactory_InstancedMesh::Destroy_Implementation(UObject* Object)
+{
+	UPoolInstancedMeshProxy* Proxy = CastChecked<UPoolInstancedMeshProxy>(Object);
+	if (Proxy->InstancedMeshComponent
+	    && Proxy->InstanceIndex != INDEX_NONE)
+	{
+		Proxy->SetInstanceTransform(GetHiddenInstanceTransform());
+		RecycledInstances.FindOrAdd(Proxy->GetClass()).Emplace(Proxy->InstanceIndex);
+	}
+
+	Proxy->InstancedMeshComponent = nullptr;
+	Proxy->InstanceIndex = INDEX_NONE;
+
+	Super::Destroy_Implementation(Object);
+}
+
+/*********************************************************************************************
+ * Pool
+ ********************************************************************************************* */
+
+// Is overridden to move the instance to the requested transform before taking the object from its pool
+void UPoolFactory_InstancedMesh::OnTakeFromPool_Implementation(UObject* Object, const FTakeFromPoolPayload& Payload)
+{
+	Super::OnTakeFromPool_Implementation(Object, Payload);
+
+	// Set transform only once: when taken from pool, not newly spawned (where it is already set on spawn)
+	if (!Payload.bIsNewSpawned)
+	{
+		UPoolInstancedMeshProxy* Proxy = CastChecked<UPoolInstancedMeshProxy>(Object);
+		Proxy->SetInstanceTransform(Payload.Transform);
+	}
+}
+
+// Is overridden to hide the instance when it is returned to the pool
+void UPoolFactory_InstancedMesh::OnChangedStateInPool_Implementation(EPoolObjectState NewState, UObject* InObject)
+{
+	Super::OnChangedStateInPool_Implementation(NewState, InObject);
+
+	// Instance is shown by setting its transform on taking, so only hide it here
+	if (NewState != EPoolObjectState::Active)
+	{
+		UPoolInstancedMeshProxy* Proxy = CastChecked<UPoolInstancedMeshProxy>(InObject);
+		Proxy->SetInstanceTransform(GetHiddenInstanceTransform());
+	}
+}
+
+/*********************************************************************************************
+ * Instanced Meshes
+ ********************************************************************************************* */
+
+// Returns the shared component that renders all instances of given proxy class, creates it on first request
+UInstancedStaticMeshComponent* UPoolFactory_InstancedMesh::FindOrAddInstancedMesh(TSubclassOf<UPoolInstancedMeshProxy> ProxyClass)
+{
+	if (!ensureMsgf(ProxyClass, TEXT("ASSERT: [%i] %hs:\n'ProxyClass' is null!"), __LINE__, __FUNCTION__))
+	{
+		return nullptr;
+	}
+
+	if (const TObjectPtr<UInstancedStaticMeshComponent>* FoundInstancedMesh = InstancedMeshes.Find(ProxyClass))
+	{
+		return *FoundInstancedMesh;
+	}
+
+	if (!IsValid(HostActor))
+	{
+		UWorld* World = GetWorld();
+		checkf(World, TEXT("ERROR: [%i] %hs:\n'World' is null!"), __LINE__, __FUNCTION__);
+		HostActor = UPoolFactory_ActorComponent::SpawnTransientHostActor(*World, TEXT("PoolInstancedMeshesHost"));
+	}
+
+	const UPoolInstancedMeshProxy* ProxyCDO = GetDefault<UPoolInstancedMeshProxy>(ProxyClass);
+	ensureMsgf(ProxyCDO->GetStaticMesh(), TEXT("ASSERT: [%i] %hs:\n'StaticMesh' is not set in defaults of %s!"), __LINE__, __FUNCTION__, *ProxyClass->GetName());
+
+	UInstancedStaticMeshComponent* NewInstancedMesh = NewObject<UInstancedStaticMeshComponent>(HostActor, *FString::Printf(TEXT("ISM_%s"), *ProxyClass->GetName()));
+	NewInstancedMesh->SetMobility(EComponentMobility::Movable); // Instances are moved on every take
+	NewInstancedMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision); // Proxies are visual-only, promote them to actors for gameplay
+	NewInstancedMesh->SetStaticMesh(ProxyCDO->GetStaticMesh());
+	NewInstancedMesh->SetupAttachment(HostActor->GetRootComponent());
+	NewInstancedMesh->RegisterComponent();
+
+	InstancedMeshes.Emplace(ProxyClass, NewInstancedMesh);
+	return NewInstancedMesh;
+}
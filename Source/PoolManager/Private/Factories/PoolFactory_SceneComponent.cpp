@@ -0,0 +1,88 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Factories/PoolFactory_SceneComponent.h"
+
+// Pool Manager
+#include "Data/PoolObjectState.h"
+#include "Data/TakeFromPoolPayload.h"
+#include "Factories/PoolFactory_Actor.h"
+
+// UE
+#include "Components/SceneComponent.h"
+#include "GameFramework/Actor.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PoolFactory_SceneComponent)
+
+// Is overridden to handle SceneComponent-inherited classes
+const UClass* UPoolFactory_SceneComponent::GetObjectClass_Implementation() const
+{
+	return USceneComponent::StaticClass();
+}
+
+/*********************************************************************************************
+ * Creation
+ ********************************************************************************************* */
+
+// Is overridden to attach the component to the host actor before its registration
+UObject* UPoolFactory_SceneComponent::SpawnNow_Implementation(const FSpawnRequest& Request)
+{
+	// Super is not called to attach the component before its registration
+
+	AActor& Host = GetHostActorChecked();
+	UClass* ComponentClass = Request.GetClassChecked<USceneComponent>();
+	UObject* Template = FindSpawnTemplate(ComponentClass);
+	USceneComponent* Component = Template
+		                             ? NewObject<USceneComponent>(&Host, ComponentClass, MakeSpawnName(ComponentClass), RF_NoFlags, Template)
+		                             : NewObject<USceneComponent>(&Host, ComponentClass);
+	Component->SetupAttachment(Host.GetRootComponent());
+
+	// Host is always at the origin, so relative transform is the same as requested world transform
+	Component->SetRelativeTransform(Request.Transform);
+	Component->RegisterComponent();
+	return Component;
+}
+
+/*********************************************************************************************
+ * Pool
+ ********************************************************************************************* */
+
+// Is overridden to set transform to the component before taking the object from its pool
+void UPoolFactory_SceneComponent::OnTakeFromPool_Implementation(UObject* Object, const FTakeFromPoolPayload& Payload)
+{
+	Super::OnTakeFromPool_Implementation(Object, Payload);
+
+	// Set transform only once: when taken from pool, not newly spawned (where it is already set on spawn)
+	if (!Payload.bIsNewSpawned)
+	{
+		USceneComponent* Component = CastChecked<USceneComponent>(Object);
+		Component->SetWorldTransform(Payload.Transform);
+	}
+}
+
+// Is overridden to attach the component back to the host actor before returning the object to its pool
+void UPoolFactory_SceneComponent::OnReturnToPool_Implementation(UObject* Object)
+{
+	Super::OnReturnToPool_Implementation(Object);
+
+	USceneComponent* Component = CastChecked<USceneComponent>(Object);
+	USceneComponent* HostRoot = GetHostActorChecked().GetRootComponent();
+	if (Component->GetAttachParent() != HostRoot)
+	{
+		// Was attached by outer code to another actor, so detach it to not be destroyed together with that actor
+		Component->AttachToComponent(HostRoot, FAttachmentTransformRules::KeepWorldTransform);
+	}
+
+	// Collision is not changed to keep physics state stable, so move it far away to not collide with anything
+	Component->SetWorldLocation(UPoolFactory_Actor::MaxPos);
+}
+
+// Is overridden to change visibility according new state
+void UPoolFactory_SceneComponent::OnChangedStateInPool_Implementation(EPoolObjectState NewState, UObject* InObject)
+{
+	Super::OnChangedStateInPool_Implementation(NewState, InObject);
+
+	USceneComponent* Component = CastChecked<USceneComponent>(InObject);
+	const bool bActivate = NewState == EPoolObjectState::Active;
+
+	Component->SetHiddenInGame(!bActivate, /*bPropagateToChildren*/ true);
+}
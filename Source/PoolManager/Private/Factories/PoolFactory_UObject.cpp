@@ -3,12 +3,18 @@
 #include "Factories/PoolFactory_UObject.h"
 
 // Pool Manager
+#include "PoolManagerStats.h"
+#include "PoolManagerTrace.h"
 #include "PoolObjectCallback.h"
 #include "Data/PoolManagerSettings.h"
 
 // UE
 #include "TimerManager.h"
+#include "Algo/Count.h"
+#include "Async/Async.h"
 #include "Engine/World.h"
+#include "Tasks/Task.h"
+#include "UObject/GarbageCollection.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(PoolFactory_UObject)
 
@@ -24,6 +30,8 @@ void UPoolFactory_UObject::RequestSpawn_Implementation(const FSpawnRequest& Requ
 		return;
 	}
 
+	LLM_SCOPE_BYTAG(PoolManager);
+
 	// Lambda to find the correct insertion index based on priority
 	auto FindInsertionIndex = [&](ESpawnRequestPriority Priority)
 	{
@@ -68,16 +76,12 @@ void UPoolFactory_UObject::RequestSpawn_Implementation(const FSpawnRequest& Requ
 		ensureAlwaysMsgf(false, TEXT("ASSERT: [%i] %hs:\n'Priority' is not valid: %d"), __LINE__, __FUNCTION__, static_cast<int32>(Request.Priority));
 	}
 
+	TRACE_POOL_OBJECT_EVENT(Queued, Request.Handle, Request.Priority);
+
 	// If this is the first object in the queue, schedule the OnNextTickProcessSpawn to be called on the next frame
 	// Creating UObjects on separate threads is not thread-safe and leads to problems with garbage collection,
 	// so we will create them on the game thread, but defer to next frame to avoid hitches
-	if (SpawnQueue.Num() == 1)
-	{
-		const UWorld* World = GetWorld();
-		checkf(World, TEXT("ERROR: [%i] %hs:\n'World' is null!"), __LINE__, __FUNCTION__);
-
-		World->GetTimerManager().SetTimerForNextTick(this, &ThisClass::OnNextTickProcessSpawn);
-	}
+	ScheduleNextTickProcessSpawn();
 }
 
 // Removes the first spawn request from the queue and returns it
@@ -98,13 +102,31 @@ bool UPoolFactory_UObject::DequeueSpawnRequest(FSpawnRequest& OutRequest)
 // Calls SpawnNow with the given request and process the callbacks
 void UPoolFactory_UObject::ProcessRequestNow(const FSpawnRequest& Request)
 {
+	POOL_MANAGER_SCOPE_CYCLE_COUNTER(STAT_PoolManager_SpawnNow);
+	LLM_SCOPE_BYTAG(PoolManager);
+	INC_DWORD_STAT(STAT_PoolManager_Spawns);
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
 	UObject* CreatedObject = SpawnNow(Request);
 	checkf(CreatedObject, TEXT("ERROR: [%i] %hs:\n'CreatedObject' failed to spawn!"), __LINE__, __FUNCTION__);
 
+	ProcessSpawnedObject(Request, *CreatedObject);
+
+	RecordSpawnHitch(Request.GetClass(), FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles));
+}
+
+// Registers just spawned object in the pool and notifies all listeners
+void UPoolFactory_UObject::ProcessSpawnedObject(const FSpawnRequest& Request, UObject& CreatedObject)
+{
 	FPoolObjectData ObjectData;
 	ObjectData.bIsActive = true;
-	ObjectData.PoolObject = CreatedObject;
+	ObjectData.PoolObject = &CreatedObject;
 	ObjectData.Handle = Request.Handle;
+	ObjectData.VariantKey = Request.VariantKey;
+	ObjectData.TakenCallSiteId = Request.CallSiteId;
+
+	TRACE_POOL_OBJECT_EVENT(Spawned, Request.Handle, Request.Priority);
 
 	OnPreRegistered(Request, ObjectData);
 	OnPostSpawned(Request, ObjectData);
@@ -113,6 +135,12 @@ void UPoolFactory_UObject::ProcessRequestNow(const FSpawnRequest& Request)
 // Alternative method to remove specific spawn request from the queue and returns it.
 bool UPoolFactory_UObject::DequeueSpawnRequestByHandle(const FPoolObjectHandle& Handle, FSpawnRequest& OutRequest)
 {
+	// Request might be already constructed on worker thread, then its object will be destroyed once constructed
+	if (WorkerThreadRequests.RemoveAndCopyValue(Handle, OutRequest))
+	{
+		return OutRequest.IsValid();
+	}
+
 	const int32 Idx = SpawnQueue.IndexOfByPredicate([&Handle](const FSpawnRequest& Request)
 	{
 		return Request.Handle == Handle;
@@ -130,10 +158,38 @@ bool UPoolFactory_UObject::DequeueSpawnRequestByHandle(const FPoolObjectHandle&
 	return OutRequest.IsValid();
 }
 
+// Returns number of requests that are waiting to be spawned by given class or of all classes if class is not specified
+int32 UPoolFactory_UObject::GetSpawnQueueNum(const UClass* ObjectClass /* = nullptr*/) const
+{
+	if (!ObjectClass)
+	{
+		return SpawnQueue.Num() + WorkerThreadRequests.Num();
+	}
+
+	auto IsSameClass = [ObjectClass](const FSpawnRequest& Request) { return Request.GetClass() == ObjectClass; };
+	auto IsSameClassPair = [&IsSameClass](const TPair<FPoolObjectHandle, FSpawnRequest>& It) { return IsSameClass(It.Value); };
+	return Algo::CountIf(SpawnQueue, IsSameClass) + Algo::CountIf(WorkerThreadRequests, IsSameClassPair);
+}
+
+// Returns number of requests of all classes that are waiting to be spawned with given priority
+int32 UPoolFactory_UObject::GetSpawnQueueNumByPriority(ESpawnRequestPriority Priority) const
+{
+	auto IsSamePriority = [Priority](const FSpawnRequest& Request) { return Request.Priority == Priority; };
+	auto IsSamePriorityPair = [&IsSamePriority](const TPair<FPoolObjectHandle, FSpawnRequest>& It) { return IsSamePriority(It.Value); };
+	return Algo::CountIf(SpawnQueue, IsSamePriority) + Algo::CountIf(WorkerThreadRequests, IsSamePriorityPair);
+}
+
 // Method to immediately spawn requested object
 UObject* UPoolFactory_UObject::SpawnNow_Implementation(const FSpawnRequest& Request)
 {
-	return NewObject<UObject>(GetOuter(), Request.GetClassChecked());
+	UClass* ObjectClass = Request.GetClassChecked();
+	UObject* Outer = GetOuter();
+	if (UObject* Template = FindSpawnTemplate(ObjectClass))
+	{
+		return NewObject<UObject>(Outer, ObjectClass, MakeSpawnName(ObjectClass), RF_NoFlags, Template);
+	}
+
+	return NewObject<UObject>(Outer, ObjectClass);
 }
 
 // Notifies all listeners that the object is about to be spawned
@@ -148,27 +204,59 @@ void UPoolFactory_UObject::OnPreRegistered(const FSpawnRequest& Request, const F
 // Notifies all listeners that the object is spawned
 void UPoolFactory_UObject::OnPostSpawned(const FSpawnRequest& Request, const FPoolObjectData& ObjectData)
 {
-	if (Request.Callbacks.OnPostSpawned != nullptr)
-	{
-		Request.Callbacks.OnPostSpawned(ObjectData);
-	}
+	RecordSpawnLatency(Request);
 
+	// Notify the object first, so listeners receive it already taken and can even return it back to the pool
 	FTakeFromPoolPayload Payload;
 	Payload.bIsNewSpawned = true;
 	Payload.Transform = Request.Transform;
-	OnTakeFromPool(ObjectData.Get(), Payload);
+	Payload.VariantKey = Request.VariantKey;
+	{
+		POOL_MANAGER_SCOPE_CYCLE_COUNTER(STAT_PoolManager_FactoryOnTake);
+		OnTakeFromPool(ObjectData.Get(), Payload);
+	}
+
+	if (Request.Callbacks.OnPostSpawned != nullptr)
+	{
+		Request.Callbacks.OnPostSpawned(ObjectData);
+	}
 }
 
 // Is called on next frame to process a chunk of the spawn queue
 void UPoolFactory_UObject::OnNextTickProcessSpawn_Implementation()
 {
+	POOL_MANAGER_SCOPE_CYCLE_COUNTER(STAT_PoolManager_ProcessSpawnQueue);
+	LLM_SCOPE_BYTAG(PoolManager);
+
+	bIsNextTickProcessSpawnScheduled = false;
+
 	int32 ObjectsPerFrame = UPoolManagerSettings::Get().GetSpawnObjectsPerFrame();
 	if (!ensureMsgf(ObjectsPerFrame >= 1, TEXT("ASSERT: [%i] %hs:\n'ObjectsPerFrame' is less than 1, set the config!"), __LINE__, __FUNCTION__))
 	{
 		ObjectsPerFrame = 1;
 	}
 
-	const int32 NumToSpawn = FMath::Min(ObjectsPerFrame, SpawnQueue.Num());
+	// Requests that can be constructed on worker threads don't consume the per-frame budget, so take them all at once
+	TArray<FSpawnRequest> WorkerRequests;
+	SpawnQueue.RemoveAll([this, &WorkerRequests](const FSpawnRequest& Request)
+	{
+		if (CanSpawnOnWorkerThread(Request))
+		{
+			WorkerRequests.Emplace(Request);
+			return true;
+		}
+		return false;
+	});
+
+	if (!WorkerRequests.IsEmpty())
+	{
+		SpawnOnWorkerThreads(MoveTemp(WorkerRequests));
+	}
+
+	// Continue objects that are spawned across multiple frames first, they share the same budget with new spawns
+	const int32 UsedBudget = ProcessDeferredSpawnStages(ObjectsPerFrame);
+
+	const int32 NumToSpawn = FMath::Min(ObjectsPerFrame - UsedBudget, SpawnQueue.Num());
 	for (int32 Index = 0; Index < NumToSpawn; ++Index)
 	{
 		FSpawnRequest OutRequest;
@@ -180,11 +268,191 @@ void UPoolFactory_UObject::OnNextTickProcessSpawn_Implementation()
 
 	// If there are more actors to spawn, schedule this function to be called again on the next frame
 	// Is deferred to next frame instead of doing it on other threads since spawning actors is not thread-safe operation
-	if (!SpawnQueue.IsEmpty())
+	if (!SpawnQueue.IsEmpty()
+	    || HasDeferredSpawnStages())
+	{
+		ScheduleNextTickProcessSpawn();
+	}
+}
+
+// Schedules OnNextTickProcessSpawn() to be called on next frame if it is not scheduled yet
+void UPoolFactory_UObject::ScheduleNextTickProcessSpawn()
+{
+	if (bIsNextTickProcessSpawnScheduled)
+	{
+		return;
+	}
+
+	const UWorld* World = GetWorld();
+	checkf(World, TEXT("ERROR: [%i] %hs:\n'World' is null!"), __LINE__, __FUNCTION__);
+
+	World->GetTimerManager().SetTimerForNextTick(this, &ThisClass::OnNextTickProcessSpawn);
+	bIsNextTickProcessSpawnScheduled = true;
+}
+
+// Processes the chunk of the spawn queue that is scheduled for next tick right away
+void UPoolFactory_UObject::ProcessScheduledSpawnNow()
+{
+	if (!bIsNextTickProcessSpawnScheduled)
+	{
+		return;
+	}
+
+	// The scheduled timer is the only one of the factory, clear it, so the chunk is not processed twice
+	if (const UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearAllTimersForObject(this);
+	}
+
+	OnNextTickProcessSpawn();
+}
+
+/*********************************************************************************************
+ * Templates
+ ********************************************************************************************* */
+
+// Sets the instance that new objects of given class are copied from
+void UPoolFactory_UObject::SetSpawnTemplate(const UClass* ObjectClass, UObject* Template)
+{
+	if (!ensureMsgf(ObjectClass, TEXT("ASSERT: [%i] %hs:\n'ObjectClass' is not specified!"), __LINE__, __FUNCTION__))
+	{
+		return;
+	}
+
+	if (!Template)
+	{
+		SpawnTemplates.Remove(ObjectClass);
+		return;
+	}
+
+	// Engine ignores actor templates of different classes, so require the same class for all factories
+	if (!ensureMsgf(Template->GetClass() == ObjectClass, TEXT("ASSERT: [%i] %hs:\n'Template' is '%s', but has to be exactly of '%s' class!"), __LINE__, __FUNCTION__, *Template->GetClass()->GetName(), *ObjectClass->GetName()))
+	{
+		return;
+	}
+
+	SpawnTemplates.Add(ObjectClass, Template);
+}
+
+// Returns the template of given class or null if new objects are created from the class default object
+UObject* UPoolFactory_UObject::FindSpawnTemplate(const UClass* ObjectClass) const
+{
+	const TObjectPtr<UObject>* FoundTemplate = !SpawnTemplates.IsEmpty() ? SpawnTemplates.Find(ObjectClass) : nullptr;
+	return FoundTemplate && IsValid(*FoundTemplate) ? FoundTemplate->Get() : nullptr;
+}
+
+// Returns the name for new object created from the template
+FName UPoolFactory_UObject::MakeSpawnName(const UClass* ObjectClass)
+{
+	checkf(ObjectClass, TEXT("ERROR: [%i] %hs:\n'ObjectClass' is null!"), __LINE__, __FUNCTION__);
+
+	const FName* FoundBaseName = SpawnBaseNames.Find(ObjectClass);
+	const FName BaseName = FoundBaseName ? *FoundBaseName : SpawnBaseNames.Add(ObjectClass, *FString::Printf(TEXT("%s_Pooled"), *ObjectClass->GetName()));
+
+	// The counter is shared by all factories and never goes back, so the name can't be taken by another pooled object and there is no need to look it up
+	return FName(BaseName, ++SpawnNameCounter);
+}
+
+/*********************************************************************************************
+ * Worker Threads Creation
+ ********************************************************************************************* */
+
+// Returns true if given request can be constructed on worker threads instead of the game thread
+bool UPoolFactory_UObject::CanSpawnOnWorkerThread(const FSpawnRequest& Request) const
+{
+	// Critical requests are expected to be spawned synchronously
+	return bSpawnOnWorkerThreads
+	       && Request.Priority != ESpawnRequestPriority::Critical;
+}
+
+// Launches background task that constructs objects of given requests
+void UPoolFactory_UObject::SpawnOnWorkerThreads(TArray<FSpawnRequest>&& Requests)
+{
+	// Requests with their callbacks stay on the game thread, only classes and handles are passed to the worker
+	TArray<TPair<FPoolObjectHandle, UClass*>> ClassesToConstruct;
+	ClassesToConstruct.Reserve(Requests.Num());
+	WorkerThreadRequests.Reserve(WorkerThreadRequests.Num() + Requests.Num());
+	for (FSpawnRequest& It : Requests)
+	{
+		ClassesToConstruct.Emplace(It.Handle, It.GetClassChecked());
+		WorkerThreadRequests.Emplace(It.Handle, MoveTemp(It));
+	}
+
+	const TWeakObjectPtr<ThisClass> WeakThis(this);
+	const TWeakObjectPtr<UObject> WeakOuter(GetOuter());
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, WeakOuter, ClassesToConstruct = MoveTemp(ClassesToConstruct)]()
+	{
+		TArray<TPair<FPoolObjectHandle, UObject*>> ConstructedObjects;
+		ConstructedObjects.Reserve(ClassesToConstruct.Num());
+		{
+			// Prevents GC from running while objects are constructed,
+			// then objects are marked as Async, so they are not collected until they are registered on the game thread
+			FGCScopeGuard GCGuard;
+
+			const ThisClass* Factory = WeakThis.Get();
+			UObject* Outer = WeakOuter.Get();
+			if (!Factory || !Outer)
+			{
+				// Pool Manager is destroyed, nothing to construct
+				return;
+			}
+
+			LLM_SCOPE_BYTAG(PoolManager);
+
+			for (const TPair<FPoolObjectHandle, UClass*>& It : ClassesToConstruct)
+			{
+				UObject* ConstructedObject = Factory->ConstructOnWorkerThread(Outer, It.Value);
+				if (ConstructedObject)
+				{
+					ConstructedObject->SetInternalFlags(EInternalObjectFlags::Async);
+					ConstructedObjects.Emplace(It.Key, ConstructedObject);
+				}
+			}
+		}
+
+		// Register all constructed objects at once with single game thread task
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, ConstructedObjects = MoveTemp(ConstructedObjects)]()
+		{
+			if (ThisClass* Factory = WeakThis.Get())
+			{
+				Factory->OnConstructedOnWorkerThreads(ConstructedObjects);
+				return;
+			}
+
+			// Factory is destroyed, so let GC collect constructed objects
+			for (const TPair<FPoolObjectHandle, UObject*>& It : ConstructedObjects)
+			{
+				It.Value->ClearInternalFlags(EInternalObjectFlags::Async);
+			}
+		});
+	});
+}
+
+// Constructs the object on worker thread, is called under GC guard
+UObject* UPoolFactory_UObject::ConstructOnWorkerThread(UObject* Outer, UClass* ObjectClass) const
+{
+	return NewObject<UObject>(Outer, ObjectClass);
+}
+
+// Registers objects constructed on worker threads, is called on the game thread
+void UPoolFactory_UObject::OnConstructedOnWorkerThreads(const TArray<TPair<FPoolObjectHandle, UObject*>>& ConstructedObjects)
+{
+	for (const TPair<FPoolObjectHandle, UObject*>& It : ConstructedObjects)
 	{
-		const UWorld* World = GetWorld();
-		checkf(World, TEXT("ERROR: [%i] %hs:\n'World' is null!"), __LINE__, __FUNCTION__);
-		World->GetTimerManager().SetTimerForNextTick(this, &ThisClass::OnNextTickProcessSpawn);
+		UObject& ConstructedObject = *It.Value;
+		ConstructedObject.ClearInternalFlags(EInternalObjectFlags::Async);
+
+		FSpawnRequest Request;
+		if (!WorkerThreadRequests.RemoveAndCopyValue(It.Key, Request))
+		{
+			// Request was cancelled while the object was constructed
+			Destroy(&ConstructedObject);
+			continue;
+		}
+
+		INC_DWORD_STAT(STAT_PoolManager_Spawns);
+
+		ProcessSpawnedObject(Request, ConstructedObject);
 	}
 }
 
@@ -221,6 +489,12 @@ void UPoolFactory_UObject::OnReturnToPool_Implementation(UObject* Object)
 	{
 		IPoolObjectCallback::Execute_OnReturnToPool(Object);
 	}
+
+	// Reset after the object is notified, so it still can read its own state in the callback
+	if (Object)
+	{
+		ResetPropertiesToDefaults(*Object);
+	}
 }
 
 // Is called when activates the object to take it from pool or deactivate when is returned back
@@ -232,3 +506,167 @@ void UPoolFactory_UObject::OnChangedStateInPool_Implementation(EPoolObjectState
 		IPoolObjectCallback::Execute_OnChangedStateInPool(InObject, NewState);
 	}
 }
+
+/*********************************************************************************************
+ * Property Reset
+ ********************************************************************************************* */
+
+// Resets properties of given object that differ from its spawn template or class default object
+void UPoolFactory_UObject::ResetPropertiesToDefaults(UObject& Object)
+{
+	const UClass* ObjectClass = Object.GetClass();
+	const TArray<const FProperty*>& Layout = GetResetPropertiesLayout(ObjectClass);
+	if (Layout.IsEmpty())
+	{
+		// Is not opted-in
+		return;
+	}
+
+	const UObject* Baseline = FindSpawnTemplate(ObjectClass);
+	if (!Baseline)
+	{
+		Baseline = ObjectClass->GetDefaultObject();
+	}
+
+	for (const FProperty* PropertyIt : Layout)
+	{
+		if (PropertyIt->Identical_InContainer(&Object, Baseline))
+		{
+			// Was not changed while the object was active
+			continue;
+		}
+
+		if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(PropertyIt))
+		{
+			// Never share subobjects of the baseline with the object or drop subobjects created at runtime
+			const UObject* Value = ObjectProperty->GetObjectPropertyValue_InContainer(&Object);
+			const UObject* BaselineValue = ObjectProperty->GetObjectPropertyValue_InContainer(Baseline);
+			if ((Value && Value->IsIn(&Object))
+			    || (BaselineValue && BaselineValue->IsIn(Baseline)))
+			{
+				continue;
+			}
+		}
+
+		PropertyIt->CopyCompleteValue_InContainer(&Object, Baseline);
+	}
+}
+
+// Returns cached list of properties that are reset on return for given class
+const TArray<const FProperty*>& UPoolFactory_UObject::GetResetPropertiesLayout(const UClass* ObjectClass)
+{
+	if (const TArray<const FProperty*>* FoundLayout = ResetPropertiesLayouts.Find(ObjectClass))
+	{
+		return *FoundLayout;
+	}
+
+	TArray<const FProperty*>& NewLayout = ResetPropertiesLayouts.Add(ObjectClass);
+	if (!UPoolManagerSettings::Get().ShouldResetPropertiesOnReturn(ObjectClass))
+	{
+		// Keep empty layout, so the class is not checked again
+		return NewLayout;
+	}
+
+	// Only properties of Blueprint classes are reset: native classes (e.g: APawn::Controller or replicated state of ACharacter)
+	// keep their state consistent with the engine by themselves, so resetting them would break possession, movement etc.
+	constexpr EPropertyFlags SkipFlags = CPF_Deprecated | CPF_InstancedReference | CPF_ContainsInstancedReference | CPF_EditorOnly;
+	for (TFieldIterator<FProperty> It(ObjectClass, EFieldIteratorFlags::IncludeSuper); It; ++It)
+	{
+		const FProperty* PropertyIt = *It;
+		const UClass* OwnerClass = PropertyIt->GetOwnerClass();
+		if (!OwnerClass
+		    || OwnerClass->HasAnyClassFlags(CLASS_Native)
+		    || PropertyIt->HasAnyPropertyFlags(SkipFlags)
+		    || PropertyIt->IsA<FDelegateProperty>()
+		    || PropertyIt->IsA<FMulticastDelegateProperty>())
+		{
+			continue;
+		}
+
+		NewLayout.Emplace(PropertyIt);
+	}
+
+	return NewLayout;
+}
+
+/*********************************************************************************************
+ * Spawn Latency
+ ********************************************************************************************* */
+
+// Returns the histogram of spawn latencies by given class and priority
+FPoolSpawnLatencyHistogram UPoolFactory_UObject::GetSpawnLatency(const UClass* ObjectClass/* = nullptr*/, ESpawnRequestPriority Priority/* = ESpawnRequestPriority::None*/) const
+{
+	FPoolSpawnLatencyHistogram Result;
+	for (const TTuple<TPair<TObjectKey<UClass>, ESpawnRequestPriority>, FPoolSpawnLatencyHistogram>& It : SpawnLatencies)
+	{
+		const bool bIsSameClass = !ObjectClass || It.Key.Key == TObjectKey<UClass>(ObjectClass);
+		const bool bIsSamePriority = Priority == ESpawnRequestPriority::None || It.Key.Value == Priority;
+		if (bIsSameClass && bIsSamePriority)
+		{
+			Result.Append(It.Value);
+		}
+	}
+	return Result;
+}
+
+// Records the spawn of given class if it took longer than 'Spawn Hitch Threshold Ms'
+void UPoolFactory_UObject::RecordSpawnHitch(const UClass* ObjectClass, double DurationMs)
+{
+	if (DurationMs < SpawnHitchThresholdMs)
+	{
+		return;
+	}
+
+	constexpr int32 MaxSpawnHitches = 16;
+
+	FPoolSpawnHitch Hitch;
+	Hitch.ObjectClass = ObjectClass;
+	Hitch.DurationMs = DurationMs;
+	Hitch.FrameNumber = GFrameCounter;
+
+	if (RecentSpawnHitches.Num() < MaxSpawnHitches)
+	{
+		RecentSpawnHitches.Emplace(MoveTemp(Hitch));
+	}
+	else
+	{
+		RecentSpawnHitches[NextSpawnHitchIndex] = MoveTemp(Hitch);
+		NextSpawnHitchIndex = (NextSpawnHitchIndex + 1) % MaxSpawnHitches;
+	}
+}
+
+// Records the latency of given request that is spawned right now
+void UPoolFactory_UObject::RecordSpawnLatency(const FSpawnRequest& Request)
+{
+	if (Request.RequestTime <= 0.0)
+	{
+		// The request was not made through the Pool Manager
+		return;
+	}
+
+	const double LatencyMs = (FPlatformTime::Seconds() - Request.RequestTime) * 1000.0;
+	const int32 LatencyFrames = static_cast<int32>(GFrameCounter - Request.RequestFrame);
+
+	const TPair<TObjectKey<UClass>, ESpawnRequestPriority> Key(TObjectKey<UClass>(Request.GetClass()), Request.Priority);
+	SpawnLatencies.FindOrAdd(Key).Add(LatencyFrames, LatencyMs);
+
+#if STATS
+	switch (Request.Priority)
+	{
+	case ESpawnRequestPriority::Normal:
+		SET_FLOAT_STAT(STAT_PoolManager_SpawnLatencyNormalMs, LatencyMs);
+		SET_DWORD_STAT(STAT_PoolManager_SpawnLatencyNormalFrames, LatencyFrames);
+		break;
+	case ESpawnRequestPriority::Medium:
+		SET_FLOAT_STAT(STAT_PoolManager_SpawnLatencyMediumMs, LatencyMs);
+		SET_DWORD_STAT(STAT_PoolManager_SpawnLatencyMediumFrames, LatencyFrames);
+		break;
+	case ESpawnRequestPriority::High:
+		SET_FLOAT_STAT(STAT_PoolManager_SpawnLatencyHighMs, LatencyMs);
+		SET_DWORD_STAT(STAT_PoolManager_SpawnLatencyHighFrames, LatencyFrames);
+		break;
+	default:
+		break;
+	}
+#endif // STATS
+}
@@ -3,6 +3,7 @@
 #include "Factories/PoolFactory_UserWidget.h"
 
 // Pool Manager
+#include "Data/PoolManagerSettings.h"
 #include "Data/PoolObjectState.h"
 
 // UE
@@ -64,6 +65,28 @@ void UPoolFactory_UserWidget::Destroy_Implementation(UObject* Object)
 	ParentWidget->ConditionalBeginDestroy();
 }
 
+// Is overridden to detach the widget from its parent and release its Slate resources if enabled in settings
+void UPoolFactory_UserWidget::OnReturnToPool_Implementation(UObject* Object)
+{
+	Super::OnReturnToPool_Implementation(Object);
+
+	const UPoolManagerSettings& Settings = UPoolManagerSettings::Get();
+	if (!Settings.ShouldDetachWidgetsOnReturn())
+	{
+		return;
+	}
+
+	// Detached widget is not part of any layout, prepass and invalidation anymore
+	UUserWidget* UserWidget = CastChecked<UUserWidget>(Object);
+	UserWidget->RemoveFromParent();
+
+	if (Settings.ShouldReleaseWidgetSlateResources())
+	{
+		// Widget Tree is kept, so Slate widgets are rebuilt lazily once it is added to a parent again
+		UserWidget->ReleaseSlateResources(/*bReleaseChildren*/ true);
+	}
+}
+
 // Is overridden to change visibility according new state
 void UPoolFactory_UserWidget::OnChangedStateInPool_Implementation(EPoolObjectState NewState, UObject* InObject)
 {
@@ -73,4 +96,11 @@ void UPoolFactory_UserWidget::OnChangedStateInPool_Implementation(EPoolObjectSta
 	const bool bActivate = NewState == EPoolObjectState::Active;
 
 	UserWidget->SetVisibility(bActivate ? ESlateVisibility::Visible : ESlateVisibility::Collapsed);
+
+	if (NewState == EPoolObjectState::Cold)
+	{
+		// Release Slate widgets of cold widgets, they are rebuilt lazily once added to a parent again
+		UserWidget->RemoveFromParent();
+		UserWidget->ReleaseSlateResources(/*bReleaseChildren*/ true);
+	}
 }
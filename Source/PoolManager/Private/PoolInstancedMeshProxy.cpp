@@ -0,0 +1,58 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "PoolInstancedMeshProxy.h"
+
+// Pool Manager
+#include "PoolManagerSubsystem.h"
+#include "Data/PoolObjectHandle.h"
+
+// UE
+#include "Components/InstancedStaticMeshComponent.h"
+#include "GameFramework/Actor.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PoolInstancedMeshProxy)
+
+// Returns the world transform of this instance
+FTransform UPoolInstancedMeshProxy::GetInstanceTransform() const
+{
+	FTransform OutTransform = FTransform::Identity;
+	if (InstancedMeshComponent)
+	{
+		InstancedMeshComponent->GetInstanceTransform(InstanceIndex, /*out*/ OutTransform, /*bWorldSpace*/ true);
+	}
+	return OutTransform;
+}
+
+// Moves this instance to the given world transform
+void UPoolInstancedMeshProxy::SetInstanceTransform(const FTransform& NewTransform)
+{
+	if (!ensureMsgf(InstancedMeshComponent, TEXT("ASSERT: [%i] %hs:\n'InstancedMeshComponent' is null, instance is not spawned by the factory!"), __LINE__, __FUNCTION__))
+	{
+		return;
+	}
+
+	InstancedMeshComponent->UpdateInstanceTransform(InstanceIndex, NewTransform, /*bWorldSpace*/ true, /*bMarkRenderStateDirty*/ true, /*bTeleport*/ true);
+}
+
+// Replaces this instance by a real actor of 'Promoted Actor Class' at the same transform when gameplay needs it
+AActor* UPoolInstancedMeshProxy::PromoteToActor()
+{
+	if (!ensureMsgf(PromotedActorClass, TEXT("ASSERT: [%i] %hs:\n'PromotedActorClass' is not set for %s!"), __LINE__, __FUNCTION__, *GetNameSafe(GetClass())))
+	{
+		return nullptr;
+	}
+
+	UPoolManagerSubsystem* PoolManager = UPoolManagerSubsystem::GetPoolManager(this);
+	if (!ensureMsgf(PoolManager, TEXT("ASSERT: [%i] %hs:\n'PoolManager' is null!"), __LINE__, __FUNCTION__))
+	{
+		return nullptr;
+	}
+
+	// Critical priority spawns the actor immediately if there are no free actors in the pool
+	const FTransform Transform = GetInstanceTransform();
+	const FPoolObjectHandle ActorHandle = PoolManager->TakeFromPool(PromotedActorClass, Transform, nullptr, ESpawnRequestPriority::Critical);
+
+	PoolManager->ReturnToPool(this);
+
+	return PoolManager->FindPoolObjectByHandle(ActorHandle).Get<AActor>();
+}
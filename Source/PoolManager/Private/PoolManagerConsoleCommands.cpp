@@ -0,0 +1,245 @@
+// Copyright (c) Yevhenii Selivanov
+
+// Pool Manager
+#include "PoolManagerSubsystem.h"
+#include "Data/PoolManagerSettings.h"
+#include "Data/PoolSpawnLatency.h"
+#include "Factories/PoolFactory_UObject.h"
+
+// UE
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+
+/*********************************************************************************************
+ * Console commands to inspect and control pools of the current world at runtime,
+ * are available in all builds with console (including Test builds and dedicated servers through RCON).
+ ********************************************************************************************* */
+
+namespace PoolManagerConsoleCommands
+{
+	/** Returns the Pool Manager of given world, prints an error if it is not available. */
+	UPoolManagerSubsystem* GetPoolManager(UWorld* World, FOutputDevice& Ar)
+	{
+		UPoolManagerSubsystem* PoolManager = World ? World->GetSubsystem<UPoolManagerSubsystem>() : nullptr;
+		if (!PoolManager)
+		{
+			Ar.Log(TEXT("Pool Manager is not available in this world"));
+		}
+		return PoolManager;
+	}
+
+	/** Returns the class by its name (e.g: 'StaticMeshActor' or 'BP_Bullet_C') or by its path, prints an error if not found. */
+	const UClass* FindClass(const FString& ClassName, FOutputDevice& Ar)
+	{
+		const UClass* FoundClass = nullptr;
+		if (ClassName.Contains(TEXT("/")))
+		{
+			FoundClass = LoadObject<UClass>(nullptr, *ClassName);
+		}
+		else
+		{
+			FoundClass = UClass::TryFindTypeSlow<UClass>(ClassName);
+			if (!FoundClass)
+			{
+				FoundClass = UClass::TryFindTypeSlow<UClass>(ClassName + TEXT("_C"));
+			}
+		}
+
+		if (!FoundClass)
+		{
+			Ar.Logf(TEXT("Class '%s' is not found"), *ClassName);
+		}
+		return FoundClass;
+	}
+
+	/** PoolManager.Dump: prints free, active, queued objects and memory of each pool. */
+	void Dump(const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		const UPoolManagerSubsystem* PoolManager = GetPoolManager(World, Ar);
+		if (!PoolManager)
+		{
+			return;
+		}
+
+		TArray<const UClass*> PoolClasses;
+		PoolManager->GetPoolClasses(/*out*/ PoolClasses);
+
+		Ar.Logf(TEXT("Pool Manager of '%s': %i pools, %i objects in spawn queue, budget %i objects per frame"),
+		        *GetNameSafe(World), PoolClasses.Num(), PoolManager->GetSpawnQueueNum(), UPoolManagerSettings::Get().GetSpawnObjectsPerFrame());
+
+		int64 TotalMemoryBytes = 0;
+		for (const UClass* ClassIt : PoolClasses)
+		{
+			const int32 FreeNum = PoolManager->GetFreeObjectsNum(ClassIt);
+			const int32 RegisteredNum = PoolManager->GetRegisteredObjectsNum(ClassIt);
+			const int32 QueuedNum = PoolManager->FindPoolFactoryChecked(ClassIt)->GetSpawnQueueNum(ClassIt);
+			const int64 MemoryBytes = PoolManager->GetPoolMemoryBytes(ClassIt);
+			TotalMemoryBytes += MemoryBytes;
+
+			const FPoolSpawnLatencyHistogram SpawnLatency = PoolManager->GetSpawnLatency(ClassIt);
+
+			Ar.Logf(TEXT("  %s: free %i, active %i, queued %i, memory %.1f KB, spawn latency p99 %i frames / %.1f ms"),
+			        *GetNameSafe(ClassIt), FreeNum, RegisteredNum - FreeNum, QueuedNum, MemoryBytes / 1024.0,
+			        SpawnLatency.GetPercentileFrames(99.f), SpawnLatency.GetPercentileMs(99.f));
+		}
+
+		Ar.Logf(TEXT("Total memory: %.1f KB"), TotalMemoryBytes / 1024.0);
+	}
+
+	/** PoolManager.Trim <Class|all> [KeepFreeNum]: destroys free objects above given amount. */
+	void Trim(const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		UPoolManagerSubsystem* PoolManager = GetPoolManager(World, Ar);
+		if (!PoolManager)
+		{
+			return;
+		}
+
+		if (Args.IsEmpty())
+		{
+			Ar.Log(TEXT("Usage: PoolManager.Trim <Class|all> [KeepFreeNum]"));
+			return;
+		}
+
+		const int32 KeepFreeNum = Args.IsValidIndex(1) ? FCString::Atoi(*Args[1]) : 0;
+
+		TArray<const UClass*> PoolClasses;
+		if (Args[0] == TEXT("all"))
+		{
+			PoolManager->GetPoolClasses(/*out*/ PoolClasses);
+		}
+		else if (const UClass* ObjectClass = FindClass(Args[0], Ar))
+		{
+			PoolClasses.Emplace(ObjectClass);
+		}
+
+		for (const UClass* ClassIt : PoolClasses)
+		{
+			const int32 DestroyedNum = PoolManager->TrimPool(ClassIt, KeepFreeNum);
+			Ar.Logf(TEXT("%s: destroyed %i free objects"), *GetNameSafe(ClassIt), DestroyedNum);
+		}
+	}
+
+	/** PoolManager.Warm <Class> <Amount>: spawns given amount of free objects in advance. */
+	void Warm(const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		UPoolManagerSubsystem* PoolManager = GetPoolManager(World, Ar);
+		if (!PoolManager)
+		{
+			return;
+		}
+
+		const int32 Amount = Args.IsValidIndex(1) ? FCString::Atoi(*Args[1]) : 0;
+		if (Amount <= 0)
+		{
+			Ar.Log(TEXT("Usage: PoolManager.Warm <Class> <Amount>"));
+			return;
+		}
+
+		if (const UClass* ObjectClass = FindClass(Args[0], Ar))
+		{
+			PoolManager->PrewarmPool(ObjectClass, Amount);
+			Ar.Logf(TEXT("%s: requested %i objects"), *GetNameSafe(ObjectClass), Amount);
+		}
+	}
+
+	/** PoolManager.Empty <Class|all>: destroys all objects of the pool, including taken ones. */
+	void Empty(const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		UPoolManagerSubsystem* PoolManager = GetPoolManager(World, Ar);
+		if (!PoolManager)
+		{
+			return;
+		}
+
+		if (Args.IsEmpty())
+		{
+			Ar.Log(TEXT("Usage: PoolManager.Empty <Class|all>"));
+			return;
+		}
+
+		if (Args[0] == TEXT("all"))
+		{
+			PoolManager->EmptyAllPools();
+			Ar.Log(TEXT("All pools are emptied"));
+		}
+		else if (const UClass* ObjectClass = FindClass(Args[0], Ar))
+		{
+			if (!PoolManager->ContainsClassInPool(ObjectClass))
+			{
+				Ar.Logf(TEXT("%s: pool does not exist"), *GetNameSafe(ObjectClass));
+				return;
+			}
+
+			PoolManager->EmptyPool(ObjectClass);
+			Ar.Logf(TEXT("%s: pool is emptied"), *GetNameSafe(ObjectClass));
+		}
+	}
+
+	/** PoolManager.SetBudget <SpawnObjectsPerFrame>: overrides how many objects are spawned per frame until restart. */
+	void SetBudget(const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		UPoolManagerSettings* Settings = GetMutableDefault<UPoolManagerSettings>();
+		if (!Args.IsEmpty())
+		{
+			Settings->SetSpawnObjectsPerFrame(FCString::Atoi(*Args[0]));
+		}
+		Ar.Logf(TEXT("Spawn Objects Per Frame: %i"), Settings->GetSpawnObjectsPerFrame());
+	}
+
+	/** PoolManager.Leaks: prints objects that are taken for longer than their leak threshold, grouped by class and call site. */
+	void Leaks(const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		const UPoolManagerSubsystem* PoolManager = GetPoolManager(World, Ar);
+		if (!PoolManager)
+		{
+			return;
+		}
+
+		if (!UPoolManagerSettings::Get().ShouldDetectLeaks())
+		{
+			Ar.Log(TEXT("Call sites are not captured since 'Detect Leaks' is disabled in the Pool Manager settings"));
+		}
+
+		TArray<FPoolLeakReport> Report;
+		PoolManager->GetLeakReport(/*out*/ Report);
+
+		Ar.Logf(TEXT("Suspected leaks: %i groups"), Report.Num());
+		for (const FPoolLeakReport& It : Report)
+		{
+			Ar.Logf(TEXT("  %s x%i (oldest %.1f s): %s"),
+			        *GetNameSafe(It.ObjectClass.Get()), It.ObjectsNum, It.OldestAgeSeconds, *PoolManager->DescribeCallSite(It.CallSiteId));
+		}
+	}
+
+	static FAutoConsoleCommandWithWorldArgsAndOutputDevice DumpCommand(
+		TEXT("PoolManager.Dump"),
+		TEXT("Prints free, active, queued objects and estimated memory of each pool in the current world."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&Dump));
+
+	static FAutoConsoleCommandWithWorldArgsAndOutputDevice TrimCommand(
+		TEXT("PoolManager.Trim"),
+		TEXT("PoolManager.Trim <Class|all> [KeepFreeNum]: destroys free objects above given amount (0 by default), taken objects are kept."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&Trim));
+
+	static FAutoConsoleCommandWithWorldArgsAndOutputDevice WarmCommand(
+		TEXT("PoolManager.Warm"),
+		TEXT("PoolManager.Warm <Class> <Amount>: spawns given amount of free objects in advance."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&Warm));
+
+	static FAutoConsoleCommandWithWorldArgsAndOutputDevice EmptyCommand(
+		TEXT("PoolManager.Empty"),
+		TEXT("PoolManager.Empty <Class|all>: destroys all objects of the pool, including taken ones."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&Empty));
+
+	static FAutoConsoleCommandWithWorldArgsAndOutputDevice LeaksCommand(
+		TEXT("PoolManager.Leaks"),
+		TEXT("Prints objects that are taken for longer than their leak threshold, grouped by class and call site."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&Leaks));
+
+	static FAutoConsoleCommandWithWorldArgsAndOutputDevice SetBudgetCommand(
+		TEXT("PoolManager.SetBudget"),
+		TEXT("PoolManager.SetBudget <SpawnObjectsPerFrame>: overrides how many objects are spawned per frame until restart, prints current value if no argument."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&SetBudget));
+}
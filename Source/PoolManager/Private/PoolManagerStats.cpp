@@ -0,0 +1,38 @@
+// Copyright (c) Yevhenii Selivanov
+
+#include "PoolManagerStats.h"
+
+DEFINE_STAT(STAT_PoolManager_TakeFromPool);
+DEFINE_STAT(STAT_PoolManager_ReturnToPool);
+DEFINE_STAT(STAT_PoolManager_SetObjectState);
+DEFINE_STAT(STAT_PoolManager_ProcessSpawnQueue);
+DEFINE_STAT(STAT_PoolManager_SpawnNow);
+DEFINE_STAT(STAT_PoolManager_Destroy);
+DEFINE_STAT(STAT_PoolManager_FactoryOnTake);
+DEFINE_STAT(STAT_PoolManager_FactoryOnReturn);
+DEFINE_STAT(STAT_PoolManager_FactoryOnChangedState);
+DEFINE_STAT(STAT_PoolManager_BatchTick);
+DEFINE_STAT(STAT_PoolManager_ProcessEnqueued);
+DEFINE_STAT(STAT_PoolManager_UpdateTiers);
+DEFINE_STAT(STAT_PoolManager_PublishSnapshot);
+
+DEFINE_STAT(STAT_PoolManager_Takes);
+DEFINE_STAT(STAT_PoolManager_Misses);
+DEFINE_STAT(STAT_PoolManager_Spawns);
+DEFINE_STAT(STAT_PoolManager_Returns);
+
+DEFINE_STAT(STAT_PoolManager_SpawnQueueDepth);
+
+DEFINE_STAT(STAT_PoolManager_PooledMemory);
+
+DEFINE_STAT(STAT_PoolManager_SpawnLatencyNormalMs);
+DEFINE_STAT(STAT_PoolManager_SpawnLatencyMediumMs);
+DEFINE_STAT(STAT_PoolManager_SpawnLatencyHighMs);
+DEFINE_STAT(STAT_PoolManager_SpawnLatencyNormalFrames);
+DEFINE_STAT(STAT_PoolManager_SpawnLatencyMediumFrames);
+DEFINE_STAT(STAT_PoolManager_SpawnLatencyHighFrames);
+
+LLM_DEFINE_TAG(PoolManager);
+
+CSV_DEFINE_CATEGORY_MODULE(POOLMANAGER_API, PoolManager, true);
+CSV_DEFINE_CATEGORY_MODULE(POOLMANAGER_API, PoolManagerClasses, true);
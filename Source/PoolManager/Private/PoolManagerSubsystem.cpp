@@ -3,6 +3,9 @@
 #include "PoolManagerSubsystem.h"
 
 // Pool Manager
+#include "PoolManagerStats.h"
+#include "PoolManagerTrace.h"
+#include "PoolObjectBatchTick.h"
 #include "Data/PoolManagerSettings.h"
 #include "Data/PoolObjectState.h"
 #include "Data/SpawnRequest.h"
@@ -10,8 +13,15 @@
 #include "Factories/PoolFactory_UObject.h"
 
 // UE
+#include "Algo/AnyOf.h"
+#include "Algo/Compare.h"
+#include "Algo/Count.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformStackWalk.h"
+#include "UObject/Script.h"
+#include "UObject/Stack.h"
 
 #if WITH_EDITOR
 #include "Editor.h"
@@ -19,6 +29,41 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(PoolManagerSubsystem)
 
+DEFINE_LOG_CATEGORY_STATIC(LogPoolManager, Log, All);
+
+#if CSV_PROFILER
+static TAutoConsoleVariable<bool> CVarPoolManagerCsvPerClassStats(
+	TEXT("PoolManager.CsvPerClassStats"),
+	false,
+	TEXT("If true, free, active, queued objects and memory of each pool are recorded to the CSV profiler, is disabled by default since stats are recorded by dynamic names."),
+	ECVF_Default);
+#endif // CSV_PROFILER
+
+/** Is the promise that is shared between spawn callbacks of async takes.
+ * If all callbacks are destroyed without completing (e.g. spawn request is cancelled), it completes with default value,
+ * so the future is never left unfulfilled that is asserted by the engine. */
+template <typename T>
+struct TPoolSharedPromise
+{
+	TPromise<T> Promise;
+	T Value;
+	bool bIsSet = false;
+
+	void SetValue(T&& InValue)
+	{
+		if (!bIsSet)
+		{
+			bIsSet = true;
+			Promise.SetValue(MoveTemp(InValue));
+		}
+	}
+
+	~TPoolSharedPromise()
+	{
+		SetValue(MoveTemp(Value));
+	}
+};
+
 /*********************************************************************************************
  * Static Getters
  ********************************************************************************************* */
@@ -81,7 +126,11 @@ void UPoolManagerSubsystem::BPTakeFromPool(const UClass* ObjectClass, const FTra
 // Is code async version of TakeFromPool() that calls callback functions when the object is ready
 FPoolObjectHandle UPoolManagerSubsystem::TakeFromPool(const UClass* ObjectClass, const FTransform& Transform /* = FTransform::Identity*/, const FOnSpawnCallback& Completed /* = nullptr*/, ESpawnRequestPriority Priority /* = ESpawnRequestPriority::Normal*/)
 {
-	const FPoolObjectData* ObjectData = TakeFromPoolOrNull(ObjectClass, Transform);
+	// Consume the key, so takes from the callback don't inherit it
+	const FName VariantKey = TakeVariantKey;
+	TakeVariantKey = NAME_None;
+
+	const FPoolObjectData* ObjectData = TakeFromPoolOrNull(ObjectClass, Transform, VariantKey);
 	if (ObjectData)
 	{
 		if (Completed != nullptr)
@@ -95,13 +144,27 @@ FPoolObjectHandle UPoolManagerSubsystem::TakeFromPool(const UClass* ObjectClass,
 	FSpawnRequest Request(ObjectClass);
 	Request.Transform = Transform;
 	Request.Priority = Priority;
+	Request.VariantKey = VariantKey;
 	Request.Callbacks.OnPostSpawned = Completed;
 	return CreateNewObjectInPool(Request);
 }
 
+// Is alternative version of TakeFromPool() that prefers free objects last used with the same variant key
+FPoolObjectHandle UPoolManagerSubsystem::TakeFromPool(const UClass* ObjectClass, const FTransform& Transform, const FOnSpawnCallback& Completed, ESpawnRequestPriority Priority, FName VariantKey)
+{
+	TGuardValue<FName> VariantKeyGuard(TakeVariantKey, VariantKey);
+	return TakeFromPool(ObjectClass, Transform, Completed, Priority);
+}
+
 // Is internal function to find object in pool or return null
 const FPoolObjectData* UPoolManagerSubsystem::TakeFromPoolOrNull(const UClass* ObjectClass, const FTransform& Transform /* = FTransform::Identity*/)
 {
+	POOL_MANAGER_SCOPE_CYCLE_COUNTER(STAT_PoolManager_TakeFromPool);
+
+	// Consume the key, so takes from callbacks of the factory don't inherit it
+	const FName VariantKey = TakeVariantKey;
+	TakeVariantKey = NAME_None;
+
 	if (!ensureMsgf(ObjectClass, TEXT("ASSERT: [%i] %hs:\n'ObjectClass' is not specified!"), __LINE__, __FUNCTION__))
 	{
 		return nullptr;
@@ -112,16 +175,39 @@ const FPoolObjectData* UPoolManagerSubsystem::TakeFromPoolOrNull(const UClass* O
 	{
 		// Pool is not registered that is ok for this function, so it returns null
 		// Outer will create new object and register it in pool
+		INC_DWORD_STAT(STAT_PoolManager_Misses);
+		++Counters.MissesNum;
 		return nullptr;
 	}
 
 	// Try to find first object contained in the Pool by its class that is inactive and ready to be taken from pool
-	const FPoolObjectData* FoundData = nullptr;
-	for (const FPoolObjectData& DataIt : Pool->PoolObjects)
+	// Prefer hot objects, cold ones are taken only if there are no hot objects since they take longer to be restored
+	// Among them, prefer objects last used with the same variant key, so they don't need to be reconfigured
+	auto GetRank = [VariantKey](const FPoolObjectData& Data)
+	{
+		const bool bIsSameVariant = Data.VariantKey == VariantKey;
+		return (Data.bIsCold ? 2 : 0) + (bIsSameVariant ? 0 : 1);
+	};
+
+	FPoolObjectData* FoundData = nullptr;
+	int32 FoundRank = MAX_int32;
+	for (FPoolObjectData& DataIt : Pool->PoolObjects)
 	{
-		if (DataIt.IsFree())
+		if (!DataIt.IsFree())
+		{
+			continue;
+		}
+
+		const int32 Rank = GetRank(DataIt);
+		if (Rank < FoundRank)
 		{
 			FoundData = &DataIt;
+			FoundRank = Rank;
+		}
+
+		if (Rank == 0)
+		{
+			// The best possible match
 			break;
 		}
 	}
@@ -129,21 +215,144 @@ const FPoolObjectData* UPoolManagerSubsystem::TakeFromPoolOrNull(const UClass* O
 	if (!FoundData)
 	{
 		// No free objects in pool
+		INC_DWORD_STAT(STAT_PoolManager_Misses);
+		++Counters.MissesNum;
 		return nullptr;
 	}
 
+	INC_DWORD_STAT(STAT_PoolManager_Takes);
+	++Counters.HitsNum;
+	TRACE_POOL_OBJECT_EVENT(Taken, FoundData->Handle);
+
 	UObject& InObject = FoundData->GetChecked();
 
+	if (FoundData->bIsCold)
+	{
+		// Restore its resources first, so the factory takes it the same way as hot object
+		SetObjectStateInPool(EPoolObjectState::Inactive, InObject, *Pool);
+	}
+
 	FTakeFromPoolPayload Payload;
 	Payload.bIsNewSpawned = false;
 	Payload.Transform = Transform;
-	Pool->GetFactoryChecked().OnTakeFromPool(&InObject, Payload);
+	Payload.VariantKey = VariantKey;
+	Payload.bNeedsReconfiguration = VariantKey.IsNone() || FoundData->VariantKey != VariantKey;
+	FoundData->VariantKey = VariantKey;
+	FoundData->TakenCallSiteId = CaptureCallSite();
+	{
+		POOL_MANAGER_SCOPE_CYCLE_COUNTER(STAT_PoolManager_FactoryOnTake);
+		Pool->GetFactoryChecked().OnTakeFromPool(&InObject, Payload);
+	}
 
 	SetObjectStateInPool(EPoolObjectState::Active, InObject, *Pool);
 
 	return FoundData;
 }
 
+// Is alternative version of TakeFromPoolOrNull() that prefers free objects last used with the same variant key
+const FPoolObjectData* UPoolManagerSubsystem::TakeFromPoolOrNull(const UClass* ObjectClass, const FTransform& Transform, FName VariantKey)
+{
+	TGuardValue<FName> VariantKeyGuard(TakeVariantKey, VariantKey);
+	return TakeFromPoolOrNull(ObjectClass, Transform);
+}
+
+// Is alternative version of TakeFromPool() that returns the future instead of the callback
+TFuture<FPoolObjectData> UPoolManagerSubsystem::TakeFromPoolAsync(FPoolObjectHandle& OutHandle, const UClass* ObjectClass, const FTransform& Transform /* = FTransform::Identity*/, ESpawnRequestPriority Priority /* = ESpawnRequestPriority::Normal*/)
+{
+	const TSharedRef<TPoolSharedPromise<FPoolObjectData>> SharedPromise = MakeShared<TPoolSharedPromise<FPoolObjectData>>();
+	TFuture<FPoolObjectData> Future = SharedPromise->Promise.GetFuture();
+
+	OutHandle = TakeFromPool(ObjectClass, Transform, [SharedPromise](const FPoolObjectData& ObjectData)
+	{
+		SharedPromise->SetValue(CopyTemp(ObjectData));
+	}, Priority);
+
+	return Future;
+}
+
+// Is alternative version of TakeFromPool() that accepts soft class and streams it asynchronously if needed
+TSharedPtr<FStreamableHandle> UPoolManagerSubsystem::TakeFromPoolSoft(FPoolObjectHandle& OutHandle, const TSoftClassPtr<UObject>& SoftObjectClass, const FTransform& Transform /* = FTransform::Identity*/, const FOnSpawnCallback& Completed /* = nullptr*/, ESpawnRequestPriority Priority /* = ESpawnRequestPriority::Normal*/)
+{
+	OutHandle = FPoolObjectHandle::EmptyHandle;
+
+	if (!ensureMsgf(!SoftObjectClass.IsNull(), TEXT("ASSERT: [%i] %hs:\n'SoftObjectClass' is not specified!"), __LINE__, __FUNCTION__))
+	{
+		return nullptr;
+	}
+
+	if (const UClass* LoadedClass = SoftObjectClass.Get())
+	{
+		// Class is already loaded, take it immediately
+		OutHandle = TakeFromPool(LoadedClass, Transform, Completed, Priority);
+		return nullptr;
+	}
+
+	// The class is not known until it is loaded, so the handle is reserved for the base class and is resolved by SoftTakes
+	const FPoolObjectHandle ReservedHandle = FPoolObjectHandle::NewHandle(UObject::StaticClass());
+	OutHandle = ReservedHandle;
+	SoftTakes.Add(ReservedHandle);
+
+	const TWeakObjectPtr<ThisClass> WeakThis(this);
+	auto OnClassLoaded = [WeakThis, SoftObjectClass, Transform, Completed, Priority, ReservedHandle]()
+	{
+		UPoolManagerSubsystem* PoolManager = WeakThis.Get();
+		if (!PoolManager
+		    || !PoolManager->SoftTakes.Contains(ReservedHandle))
+		{
+			// Was cancelled by returning the reserved handle while loading
+			return;
+		}
+
+		const UClass* LoadedClass = SoftObjectClass.Get();
+		if (!ensureMsgf(LoadedClass, TEXT("ASSERT: [%i] %hs:\nFailed to load '%s' class!"), __LINE__, __FUNCTION__, *SoftObjectClass.ToString()))
+		{
+			PoolManager->SoftTakes.Remove(ReservedHandle);
+			return;
+		}
+
+		// Once the object is ready, the reserved handle becomes the alias of its own handle until the object is returned
+		auto OnTaken = [WeakThis, ReservedHandle, Completed](const FPoolObjectData& ObjectData)
+		{
+			UPoolManagerSubsystem* PoolManager = WeakThis.Get();
+			FPoolContainer* Pool = PoolManager ? PoolManager->FindPool(ObjectData.Handle.GetObjectClass()) : nullptr;
+			if (FPoolObjectData* MutableData = Pool ? Pool->FindInPool(ObjectData.Handle) : nullptr)
+			{
+				MutableData->ReservedHandle = ReservedHandle;
+			}
+
+			if (Completed != nullptr)
+			{
+				Completed(ObjectData);
+			}
+		};
+
+		// The class is referenced by its pool from now on, so it is not garbage collected once loading handle is released
+		const FPoolObjectHandle ObjectHandle = PoolManager->TakeFromPool(LoadedClass, Transform, OnTaken, Priority);
+
+		// Is found again, since the object could be already returned by the callback
+		if (FPoolSoftTake* SoftTake = PoolManager->SoftTakes.Find(ReservedHandle))
+		{
+			SoftTake->StreamableHandle.Reset();
+			SoftTake->ObjectHandle = ObjectHandle;
+		}
+	};
+
+	const TAsyncLoadPriority LoadPriority = Priority == ESpawnRequestPriority::Critical
+		                                        ? FStreamableManager::AsyncLoadHighPriority
+		                                        : FStreamableManager::DefaultAsyncLoadPriority;
+	TSharedPtr<FStreamableHandle> StreamableHandle = StreamableManager.RequestAsyncLoad(SoftObjectClass.ToSoftObjectPath(), FStreamableDelegate::CreateLambda(OnClassLoaded), LoadPriority);
+
+	// Is kept only while loading, the class could be loaded right away
+	FPoolSoftTake* SoftTake = SoftTakes.Find(ReservedHandle);
+	if (SoftTake
+	    && !SoftTake->ObjectHandle.IsValid())
+	{
+		SoftTake->StreamableHandle = StreamableHandle;
+	}
+
+	return StreamableHandle;
+}
+
 /*********************************************************************************************
  * Take From Pool (multiple objects)
  ********************************************************************************************* */
@@ -244,6 +453,44 @@ void UPoolManagerSubsystem::TakeFromPoolArray(TArray<FPoolObjectHandle>& OutHand
 	CreateNewObjectsArrayInPool(InRequests, OutHandles, Completed);
 }
 
+// Is alternative version of TakeFromPoolArray() that returns the future completed once all objects are ready
+TFuture<TArray<FPoolObjectData>> UPoolManagerSubsystem::TakeFromPoolArrayAsync(TArray<FPoolObjectHandle>& OutHandles, const UClass* ObjectClass, int32 Amount, ESpawnRequestPriority Priority /* = ESpawnRequestPriority::Normal*/)
+{
+	const TSharedRef<TPoolSharedPromise<TArray<FPoolObjectData>>> SharedPromise = MakeShared<TPoolSharedPromise<TArray<FPoolObjectData>>>();
+	TFuture<TArray<FPoolObjectData>> Future = SharedPromise->Promise.GetFuture();
+
+	if (!OutHandles.IsEmpty())
+	{
+		OutHandles.Empty();
+	}
+
+	if (!ensureMsgf(ObjectClass, TEXT("ASSERT: [%i] %hs:\n'ObjectClass' is not specified!"), __LINE__, __FUNCTION__)
+	    || !ensureMsgf(Amount > 0, TEXT("ASSERT: [%i] %hs:\n'Amount' is less than 1!"), __LINE__, __FUNCTION__))
+	{
+		// Shared promise is completed with empty array on destruction
+		return Future;
+	}
+
+	// Collect each object separately instead of waiting for the last request, so cancelled requests do not block the future
+	SharedPromise->Value.Reserve(Amount);
+	const FOnSpawnCallback OnEachTaken = [SharedPromise, Amount](const FPoolObjectData& ObjectData)
+	{
+		SharedPromise->Value.Emplace(ObjectData);
+		if (SharedPromise->Value.Num() >= Amount)
+		{
+			SharedPromise->SetValue(MoveTemp(SharedPromise->Value));
+		}
+	};
+
+	OutHandles.Reserve(Amount);
+	for (int32 Index = 0; Index < Amount; ++Index)
+	{
+		OutHandles.Emplace(TakeFromPool(ObjectClass, FTransform::Identity, OnEachTaken, Priority));
+	}
+
+	return Future;
+}
+
 // Is alternative version of TakeFromPoolArrayOrNull() to find multiple object in pool or return null
 void UPoolManagerSubsystem::TakeFromPoolArrayOrNull(TArray<FPoolObjectData>& OutObjects, TArray<FSpawnRequest>& InRequests)
 {
@@ -254,7 +501,7 @@ void UPoolManagerSubsystem::TakeFromPoolArrayOrNull(TArray<FPoolObjectData>& Out
 
 	for (FSpawnRequest& ItRef : InRequests)
 	{
-		if (const FPoolObjectData* ObjectData = TakeFromPoolOrNull(ItRef.GetClass(), ItRef.Transform))
+		if (const FPoolObjectData* ObjectData = TakeFromPoolOrNull(ItRef.GetClass(), ItRef.Transform, ItRef.VariantKey))
 		{
 			ItRef.Handle = ObjectData->Handle;
 			OutObjects.Emplace(*ObjectData);
@@ -269,13 +516,27 @@ void UPoolManagerSubsystem::TakeFromPoolArrayOrNull(TArray<FPoolObjectData>& Out
 // Returns the specified object to the pool and deactivates it if the object was taken from the pool before
 bool UPoolManagerSubsystem::ReturnToPool_Implementation(UObject* Object)
 {
+	POOL_MANAGER_SCOPE_CYCLE_COUNTER(STAT_PoolManager_ReturnToPool);
+
 	if (!ensureMsgf(Object, TEXT("ASSERT: [%i] %hs:\n'Object' is null!"), __LINE__, __FUNCTION__))
 	{
 		return false;
 	}
 
+	INC_DWORD_STAT(STAT_PoolManager_Returns);
+	++Counters.ReturnsNum;
+
 	FPoolContainer& Pool = FindPoolOrAdd(Object->GetClass());
-	Pool.GetFactoryChecked().OnReturnToPool(Object);
+#if POOL_MANAGER_TRACE_ENABLED
+	if (const FPoolObjectData* ObjectData = Pool.FindInPool(*Object))
+	{
+		TRACE_POOL_OBJECT_EVENT(Returned, ObjectData->Handle);
+	}
+#endif // POOL_MANAGER_TRACE_ENABLED
+	{
+		POOL_MANAGER_SCOPE_CYCLE_COUNTER(STAT_PoolManager_FactoryOnReturn);
+		Pool.GetFactoryChecked().OnReturnToPool(Object);
+	}
 
 	SetObjectStateInPool(EPoolObjectState::Inactive, *Object, Pool);
 
@@ -290,6 +551,23 @@ bool UPoolManagerSubsystem::ReturnToPool(const FPoolObjectHandle& Handle)
 		return false;
 	}
 
+	// Handles reserved by TakeFromPoolSoft() don't refer to the class of the object, so they are resolved first
+	FPoolSoftTake SoftTake;
+	if (SoftTakes.RemoveAndCopyValue(Handle, SoftTake))
+	{
+		if (SoftTake.ObjectHandle.IsValid())
+		{
+			return ReturnToPool(SoftTake.ObjectHandle);
+		}
+
+		// The class is still loading, so there is nothing to return yet
+		if (SoftTake.StreamableHandle.IsValid())
+		{
+			SoftTake.StreamableHandle->CancelHandle();
+		}
+		return true;
+	}
+
 	const FPoolContainer& Pool = FindPoolOrAdd(Handle.GetObjectClass());
 	if (const FPoolObjectData* ObjectData = Pool.FindInPool(Handle))
 	{
@@ -301,6 +579,10 @@ bool UPoolManagerSubsystem::ReturnToPool(const FPoolObjectHandle& Handle)
 	// cancel spawn request if object returns to pool faster than it is spawned
 	FSpawnRequest OutRequest;
 	const bool bSucceed = Pool.GetFactoryChecked().DequeueSpawnRequestByHandle(Handle, OutRequest);
+	if (bSucceed)
+	{
+		TRACE_POOL_OBJECT_EVENT(Cancelled, Handle, OutRequest.Priority);
+	}
 	return ensureMsgf(bSucceed, TEXT("ASSERT: [%i] %hs:\nGiven Handle is not known by Pool Manager and is not even in spawning queue!"), __LINE__, __FUNCTION__);
 }
 
@@ -330,6 +612,92 @@ bool UPoolManagerSubsystem::ReturnToPoolArray(const TArray<FPoolObjectHandle>& H
 	return bSucceed;
 }
 
+/*********************************************************************************************
+ * Thread-Safe Requests
+ ********************************************************************************************* */
+
+// Is thread-safe alternative to TakeFromPool() that can be called from any thread
+FPoolObjectHandle UPoolManagerSubsystem::EnqueueTakeFromPool(const UClass* ObjectClass, const FTransform& Transform /* = FTransform::Identity*/, const FOnSpawnCallback& Completed /* = nullptr*/, ESpawnRequestPriority Priority /* = ESpawnRequestPriority::Normal*/)
+{
+	if (!ensureMsgf(ObjectClass, TEXT("ASSERT: [%i] %hs:\n'ObjectClass' is not specified!"), __LINE__, __FUNCTION__))
+	{
+		return FPoolObjectHandle::EmptyHandle;
+	}
+
+	// Generating handle is thread-safe, so it is reserved immediately
+	FPoolEnqueuedRequest NewRequest;
+	NewRequest.Type = FPoolEnqueuedRequest::EType::Take;
+	NewRequest.Request = FSpawnRequest(ObjectClass);
+	NewRequest.Request.Transform = Transform;
+	NewRequest.Request.Priority = Priority;
+	NewRequest.Request.Callbacks.OnPostSpawned = Completed;
+
+	const FPoolObjectHandle Handle = NewRequest.Request.Handle;
+	EnqueuedRequests.Enqueue(MoveTemp(NewRequest));
+	return Handle;
+}
+
+// Is thread-safe alternative to ReturnToPool() by handle that can be called from any thread
+void UPoolManagerSubsystem::EnqueueReturnToPool(const FPoolObjectHandle& Handle)
+{
+	if (!ensureMsgf(Handle.IsValid(), TEXT("ASSERT: [%i] %hs:\n'Handle' is not valid!"), __LINE__, __FUNCTION__))
+	{
+		return;
+	}
+
+	FPoolEnqueuedRequest NewRequest;
+	NewRequest.Type = FPoolEnqueuedRequest::EType::Return;
+	NewRequest.Request.Handle = Handle;
+	EnqueuedRequests.Enqueue(MoveTemp(NewRequest));
+}
+
+// Processes all requests enqueued from any thread in one pass
+void UPoolManagerSubsystem::ProcessEnqueuedRequests()
+{
+	POOL_MANAGER_SCOPE_CYCLE_COUNTER(STAT_PoolManager_ProcessEnqueued);
+
+	check(IsInGameThread());
+
+	FPoolEnqueuedRequest It;
+	while (EnqueuedRequests.Dequeue(It))
+	{
+		FSpawnRequest& Request = It.Request;
+		if (It.Type == FPoolEnqueuedRequest::EType::Return)
+		{
+			ReturnToPool(Request.Handle);
+			continue;
+		}
+
+		const FPoolObjectData* TakenData = TakeFromPoolOrNull(Request.GetClass(), Request.Transform, Request.VariantKey);
+		if (!TakenData)
+		{
+			// No free objects, spawn new one with already reserved handle
+			CreateNewObjectInPool(Request);
+			continue;
+		}
+
+		// Keep the own handle of taken object, so handles cached earlier stay valid, while the reserved one becomes its alias
+		FPoolContainer& Pool = FindPoolOrAdd(Request.GetClass());
+		FPoolObjectData* MutableData = Pool.FindInPool(TakenData->Handle);
+		checkf(MutableData, TEXT("ERROR: [%i] %hs:\n'MutableData' is not found for just taken object!"), __LINE__, __FUNCTION__);
+		MutableData->ReservedHandle = Request.Handle;
+
+		if (Request.Callbacks.OnPostSpawned != nullptr)
+		{
+			Request.Callbacks.OnPostSpawned(*MutableData);
+		}
+	}
+}
+
+// Is bound to process enqueued requests at the start of world tick
+void UPoolManagerSubsystem::OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World == GetWorld())
+	{
+		ProcessEnqueuedRequests();
+	}
+}
+
 /*********************************************************************************************
  * Advanced
  ********************************************************************************************* */
@@ -358,9 +726,15 @@ bool UPoolManagerSubsystem::RegisterObjectInPool_Implementation(const FPoolObjec
 		Data.Handle = FPoolObjectHandle::NewHandle(ObjectClass);
 	}
 
+	// Register as inactive first, the requested state is applied right after to track the state change
+	const EPoolObjectState NewState = Data.GetState();
+	Data.bIsActive = false;
+
+	LLM_SCOPE_BYTAG(PoolManager);
 	Pool.PoolObjects.Emplace(Data);
+	++Counters.SpawnsNum;
 
-	SetObjectStateInPool(Data.GetState(), *Data.PoolObject, Pool);
+	SetObjectStateInPool(NewState, *Data.PoolObject, Pool);
 
 	return true;
 }
@@ -380,6 +754,14 @@ FPoolObjectHandle UPoolManagerSubsystem::CreateNewObjectInPool_Implementation(co
 		Request.Handle = FPoolObjectHandle::NewHandle(Request.GetClass());
 	}
 
+	if (!Request.CallSiteId)
+	{
+		Request.CallSiteId = CaptureCallSite();
+	}
+
+	Request.RequestTime = FPlatformTime::Seconds();
+	Request.RequestFrame = GFrameCounter;
+
 	// Always register new object in pool once it is spawned
 	const TWeakObjectPtr<ThisClass> WeakThis(this);
 	Request.Callbacks.OnPreRegistered = [WeakThis](const FPoolObjectData& ObjectData)
@@ -390,6 +772,8 @@ FPoolObjectHandle UPoolManagerSubsystem::CreateNewObjectInPool_Implementation(co
 		}
 	};
 
+	TRACE_POOL_OBJECT_EVENT(Requested, Request.Handle, Request.Priority);
+
 	const FPoolContainer& Pool = FindPoolOrAdd(Request.GetClass());
 	Pool.GetFactoryChecked().RequestSpawn(Request);
 
@@ -436,6 +820,32 @@ void UPoolManagerSubsystem::CreateNewObjectsArrayInPool(TArray<FSpawnRequest>& I
 	}
 }
 
+// Creates given amount of new objects that are returned to the pool right after spawning
+void UPoolManagerSubsystem::PrewarmPool(const UClass* ObjectClass, int32 Amount, ESpawnRequestPriority Priority /* = ESpawnRequestPriority::Normal*/)
+{
+	if (!ensureMsgf(ObjectClass, TEXT("ASSERT: [%i] %hs:\n'ObjectClass' is not specified!"), __LINE__, __FUNCTION__)
+	    || !ensureMsgf(Amount > 0, TEXT("ASSERT: [%i] %hs:\n'Amount' is less than 1!"), __LINE__, __FUNCTION__))
+	{
+		return;
+	}
+
+	TArray<FSpawnRequest> InRequests;
+	FSpawnRequest::MakeRequests(/*out*/ InRequests, ObjectClass, Amount, Priority);
+
+	const TWeakObjectPtr<ThisClass> WeakThis(this);
+	for (FSpawnRequest& It : InRequests)
+	{
+		It.Callbacks.OnPostSpawned = [WeakThis](const FPoolObjectData& ObjectData)
+		{
+			if (UPoolManagerSubsystem* PoolManager = WeakThis.Get())
+			{
+				PoolManager->ReturnToPool(ObjectData.PoolObject);
+			}
+		};
+		CreateNewObjectInPool(It);
+	}
+}
+
 /*********************************************************************************************
  * Advanced - Factories
  ********************************************************************************************* */
@@ -559,6 +969,8 @@ void UPoolManagerSubsystem::EmptyPool_Implementation(const UClass* ObjectClass)
 		UObject* ObjectIt = PoolObjects.IsValidIndex(Index) ? PoolObjects[Index].Get() : nullptr;
 		if (IsValid(ObjectIt))
 		{
+			POOL_MANAGER_SCOPE_CYCLE_COUNTER(STAT_PoolManager_Destroy);
+			TRACE_POOL_OBJECT_EVENT(Destroyed, PoolObjects[Index].Handle);
 			Factory.Destroy(ObjectIt);
 		}
 	}
@@ -606,70 +1018,430 @@ void UPoolManagerSubsystem::EmptyAllByPredicate(const TFunctionRef<bool(const UO
 				continue;
 			}
 
+			POOL_MANAGER_SCOPE_CYCLE_COUNTER(STAT_PoolManager_Destroy);
+			TRACE_POOL_OBJECT_EVENT(Destroyed, PoolObjectsRef[ObjectIndex].Handle);
 			Factory.Destroy(ObjectIt);
 
 			PoolObjectsRef.RemoveAt(ObjectIndex);
+			PoolIt.ActiveObjects.RemoveSwap(ObjectIt);
 		}
 	}
 }
 
-/*********************************************************************************************
- * Getters
- ********************************************************************************************* */
-
-// Returns current state of specified object
-EPoolObjectState UPoolManagerSubsystem::GetPoolObjectState_Implementation(const UObject* Object) const
+// Destroys free objects of a pool by given class above specified amount, while taken objects are kept
+int32 UPoolManagerSubsystem::TrimPool_Implementation(const UClass* ObjectClass, int32 KeepFreeNum/* = 0*/)
 {
-	const UClass* ObjectClass = Object ? Object->GetClass() : nullptr;
-	const FPoolContainer* Pool = FindPool(ObjectClass);
-	const FPoolObjectData* PoolObject = Pool ? Pool->FindInPool(*Object) : nullptr;
+	FPoolContainer* Pool = FindPool(ObjectClass);
+	if (!Pool)
+	{
+		return 0;
+	}
 
-	if (!PoolObject
-	    || !PoolObject->IsValid())
+	int32 ObjectsToDestroyNum = GetFreeObjectsNum(ObjectClass) - FMath::Max(KeepFreeNum, 0);
+	if (ObjectsToDestroyNum <= 0)
 	{
-		// Is not contained in any pool
-		return EPoolObjectState::None;
+		return 0;
 	}
 
-	return PoolObject->GetState();
-}
+	UPoolFactory_UObject& Factory = Pool->GetFactoryChecked();
+	TArray<FPoolObjectData>& PoolObjects = Pool->PoolObjects;
+	int32 DestroyedNum = 0;
 
-// Returns true is specified object is handled by Pool Manager
-bool UPoolManagerSubsystem::ContainsObjectInPool_Implementation(const UObject* Object) const
-{
-	return GetPoolObjectState(Object) != EPoolObjectState::None;
-}
+	// Destroy cold objects first, then hot ones starting from the most recently added
+	for (const bool bDestroyCold : {true, false})
+	{
+		for (int32 Index = PoolObjects.Num() - 1; Index >= 0 && DestroyedNum < ObjectsToDestroyNum; --Index)
+		{
+			const FPoolObjectData& DataIt = PoolObjects[Index];
+			if (!DataIt.IsFree()
+			    || DataIt.bIsCold != bDestroyCold)
+			{
+				continue;
+			}
 
-bool UPoolManagerSubsystem::ContainsClassInPool_Implementation(const UClass* ObjectClass) const
-{
-	return FindPool(ObjectClass) != nullptr;
+			POOL_MANAGER_SCOPE_CYCLE_COUNTER(STAT_PoolManager_Destroy);
+			TRACE_POOL_OBJECT_EVENT(Destroyed, DataIt.Handle);
+			Factory.Destroy(DataIt.Get());
+
+			PoolObjects.RemoveAt(Index);
+			++DestroyedNum;
+		}
+	}
+
+	return DestroyedNum;
 }
 
-// Returns true if specified object is handled by the Pool Manager and was taken from its pool
-bool UPoolManagerSubsystem::IsActive_Implementation(const UObject* Object) const
+/*********************************************************************************************
+ * Batch Tick
+ ********************************************************************************************* */
+
+// Ticks all active objects of batched pools
+void UPoolManagerSubsystem::TickBatchedPools(float DeltaTime)
 {
-	return GetPoolObjectState(Object) == EPoolObjectState::Active;
+	POOL_MANAGER_SCOPE_CYCLE_COUNTER(STAT_PoolManager_BatchTick);
+
+	TGuardValue<bool> BatchTickingGuard(bIsBatchTicking, true);
+
+	// Iterate by index and never keep references to pools, since ticked objects might take objects of new classes, so pools are reallocated
+	for (int32 PoolIndex = 0; PoolIndex < Pools.Num(); ++PoolIndex)
+	{
+		if (!Pools[PoolIndex].bBatchTick)
+		{
+			continue;
+		}
+
+		// Tick a copy of active objects: the dense list is reordered when objects are returned to the pool during their tick
+		BatchTickingObjects.Reset();
+		BatchTickingObjects.Append(Pools[PoolIndex].ActiveObjects);
+		ReturnedWhileBatchTicking.Reset();
+
+		for (UObject* ObjectIt : BatchTickingObjects)
+		{
+			IPoolObjectBatchTick* TickableObject = Cast<IPoolObjectBatchTick>(ObjectIt);
+			if (TickableObject
+			    && IsValid(ObjectIt)
+			    && !ReturnedWhileBatchTicking.Contains(ObjectIt))
+			{
+				TickableObject->OnPoolBatchTick(DeltaTime);
+			}
+		}
+	}
+
+	BatchTickingObjects.Reset();
+	ReturnedWhileBatchTicking.Reset();
 }
 
-// Returns true if handled object is inactive and ready to be taken from pool
-bool UPoolManagerSubsystem::IsFreeObjectInPool_Implementation(const UObject* Object) const
+// Returns all objects of specified class that are currently taken from the pool
+const TArray<TObjectPtr<UObject>>& UPoolManagerSubsystem::GetActiveObjects(const UClass* ObjectClass) const
 {
-	return GetPoolObjectState(Object) == EPoolObjectState::Inactive;
+	const FPoolContainer* Pool = FindPool(ObjectClass);
+	return Pool ? Pool->ActiveObjects : FPoolContainer::EmptyPool.ActiveObjects;
 }
 
-// Returns number of free objects in pool by specified class
-int32 UPoolManagerSubsystem::GetFreeObjectsNum_Implementation(const UClass* ObjectClass) const
+// Registers the batch tick function in the world if it is not registered yet
+void UPoolManagerSubsystem::RegisterBatchTickFunction()
 {
-	const FPoolContainer* Pool = FindPool(ObjectClass);
-	if (!Pool)
+	if (BatchTickFunction.IsTickFunctionRegistered())
 	{
-		return 0;
+		return;
 	}
 
-	int32 FreeObjectsNum = 0;
-	for (const FPoolObjectData& PoolObjectIt : Pool->PoolObjects)
+	UWorld* World = GetWorld();
+	if (!World || !World->IsGameWorld()
+	    || !World->PersistentLevel)
 	{
-		if (PoolObjectIt.IsFree())
+		// Batched objects are ticked only during the game
+		return;
+	}
+
+	BatchTickFunction.PoolManager = this;
+	BatchTickFunction.RegisterTickFunction(World->PersistentLevel);
+}
+
+/*********************************************************************************************
+ * Hot/Cold Tiers
+ ********************************************************************************************* */
+
+// Demotes free objects that stayed hot for too long to the cold tier and promotes cold objects back when there are not enough hot ones
+void UPoolManagerSubsystem::UpdatePoolTiers()
+{
+	POOL_MANAGER_SCOPE_CYCLE_COUNTER(STAT_PoolManager_UpdateTiers);
+
+	const UPoolManagerSettings& Settings = UPoolManagerSettings::Get();
+	const int32 HotObjectsNum = Settings.GetHotObjectsNum();
+	const double DemotionDelay = Settings.GetColdDemotionDelay();
+	const double CurrentTime = FPlatformTime::Seconds();
+
+	// Changing tier is as heavy as spawning (e.g: registering components), so share the same budget to avoid spikes
+	int32 Budget = FMath::Max(Settings.GetSpawnObjectsPerFrame(), 1);
+
+	// Iterate by indices since factories run user code on state change that can add new pools or objects
+	// Start from the pool next to the one where the budget ran out last time, so later pools are not starved by earlier ones
+	const int32 PoolsNum = Pools.Num();
+	for (int32 VisitedNum = 0; VisitedNum < PoolsNum && Budget > 0; ++VisitedNum)
+	{
+		const int32 PoolIndex = (TiersPoolCursor + VisitedNum) % PoolsNum;
+		int32 HotFreeNum = Algo::CountIf(Pools[PoolIndex].PoolObjects, [](const FPoolObjectData& It) { return It.IsHot(); });
+
+		for (int32 Index = 0; Index < Pools[PoolIndex].PoolObjects.Num() && Budget > 0; ++Index)
+		{
+			const FPoolObjectData& DataIt = Pools[PoolIndex].PoolObjects[Index];
+			if (!DataIt.IsFree())
+			{
+				continue;
+			}
+
+			UObject& InObject = DataIt.GetChecked();
+			if (DataIt.bIsCold && HotFreeNum < HotObjectsNum)
+			{
+				// Promote ahead of demand
+				SetObjectStateInPool(EPoolObjectState::Inactive, InObject, Pools[PoolIndex]);
+				++HotFreeNum;
+				--Budget;
+			}
+			else if (!DataIt.bIsCold && HotFreeNum > HotObjectsNum
+			         && CurrentTime - DataIt.LastStateChangeTime >= DemotionDelay)
+			{
+				// Demote the excess of hot objects
+				SetObjectStateInPool(EPoolObjectState::Cold, InObject, Pools[PoolIndex]);
+				--HotFreeNum;
+				--Budget;
+			}
+		}
+
+		if (Budget <= 0)
+		{
+			TiersPoolCursor = (PoolIndex + 1) % PoolsNum;
+		}
+	}
+}
+
+/*********************************************************************************************
+ * Leak Detection
+ ********************************************************************************************* */
+
+// Captures the call stack of the current take and returns its id, or 0 if leak detection is disabled
+uint32 UPoolManagerSubsystem::CaptureCallSite()
+{
+	if (!UPoolManagerSettings::Get().ShouldDetectLeaks())
+	{
+		return 0;
+	}
+
+	// Deep enough to skip frames of the Pool Manager itself
+	constexpr uint32 MaxDepth = 16;
+	uint64 BackTrace[MaxDepth];
+	const uint32 Depth = FPlatformStackWalk::CaptureStackBackTrace(BackTrace, MaxDepth);
+
+	uint32 CallSiteId = GetTypeHash(Depth);
+	for (uint32 Index = 0; Index < Depth; ++Index)
+	{
+		CallSiteId = HashCombineFast(CallSiteId, GetTypeHash(BackTrace[Index]));
+	}
+
+	// All Blueprint callers have the same native frames of the script VM, so they are distinguished by their script call stack
+	FString ScriptStack;
+#if DO_BLUEPRINT_GUARD
+	if (FBlueprintContextTracker::Get().GetScriptStack().Num() > 0)
+	{
+		ScriptStack = FFrame::GetScriptCallstack(/*bReturnEmpty*/true);
+		CallSiteId = HashCombineFast(CallSiteId, GetTypeHash(ScriptStack));
+	}
+#endif // DO_BLUEPRINT_GUARD
+
+	const TArrayView<const uint64> BackTraceView(BackTrace, Depth);
+	for (;;)
+	{
+		// 0 is reserved for not captured call sites
+		CallSiteId = FMath::Max(CallSiteId, 1u);
+
+		const FPoolCallSite* FoundCallSite = CallSites.Find(CallSiteId);
+		if (!FoundCallSite)
+		{
+			break;
+		}
+
+		if (Algo::Compare(FoundCallSite->BackTrace, BackTraceView)
+		    && FoundCallSite->ScriptStack == ScriptStack)
+		{
+			return CallSiteId;
+		}
+
+		// Different call stacks have the same hash, so probe the next id
+		++CallSiteId;
+	}
+
+	LLM_SCOPE_BYTAG(PoolManager);
+	FPoolCallSite& NewCallSite = CallSites.Add(CallSiteId);
+	NewCallSite.BackTrace.Append(BackTraceView);
+	NewCallSite.ScriptStack = MoveTemp(ScriptStack);
+
+	return CallSiteId;
+}
+
+// Returns readable description of the captured call site
+FString UPoolManagerSubsystem::DescribeCallSite(uint32 CallSiteId) const
+{
+	const FPoolCallSite* CallSite = CallSites.Find(CallSiteId);
+	if (!CallSite)
+	{
+		return TEXT("unknown call site");
+	}
+
+	if (!CallSite->Description.IsEmpty())
+	{
+		return CallSite->Description;
+	}
+
+	// Functions to skip since they are part of the Pool Manager or the stack walk itself
+	static const TCHAR* SkippedFunctions[] = {TEXT("FPlatformStackWalk"), TEXT("FGenericPlatformStackWalk"), TEXT("UPoolManagerSubsystem::"), TEXT("UPoolFactory_"), TEXT("UPoolManagerUtils::")};
+	constexpr int32 MaxFunctions = 3;
+
+	TArray<FString> Functions;
+
+	// The innermost Blueprint function goes first in the script call stack
+	TArray<FString> ScriptFunctions;
+	CallSite->ScriptStack.ParseIntoArrayLines(ScriptFunctions);
+	if (!ScriptFunctions.IsEmpty())
+	{
+		Functions.Emplace(ScriptFunctions[0].TrimStartAndEnd());
+	}
+
+	for (const uint64 ProgramCounter : CallSite->BackTrace)
+	{
+		FProgramCounterSymbolInfo SymbolInfo;
+		FPlatformStackWalk::ProgramCounterToSymbolInfo(ProgramCounter, SymbolInfo);
+
+		const FString FunctionName = ANSI_TO_TCHAR(SymbolInfo.FunctionName);
+		const bool bIsSkipped = Algo::AnyOf(SkippedFunctions, [&FunctionName](const TCHAR* It) { return FunctionName.Contains(It); });
+		if (bIsSkipped
+		    || FunctionName.IsEmpty())
+		{
+			continue;
+		}
+
+		Functions.Emplace(FString::Printf(TEXT("%s (%hs:%i)"), *FunctionName, SymbolInfo.Filename, SymbolInfo.LineNumber));
+		if (Functions.Num() >= MaxFunctions)
+		{
+			break;
+		}
+	}
+
+	CallSite->Description = Functions.IsEmpty() ? FString::Printf(TEXT("call site %u"), CallSiteId) : FString::Join(Functions, TEXT(" <- "));
+	return CallSite->Description;
+}
+
+// Returns active objects that are taken for longer than their leak threshold, grouped by class and call site
+void UPoolManagerSubsystem::GetLeakReport(TArray<FPoolLeakReport>& OutReport) const
+{
+	const UPoolManagerSettings& Settings = UPoolManagerSettings::Get();
+	const double CurrentTime = FPlatformTime::Seconds();
+
+	for (const FPoolContainer& PoolIt : Pools)
+	{
+		if (PoolIt.ActiveObjects.IsEmpty())
+		{
+			continue;
+		}
+
+		const float LeakThreshold = Settings.GetLeakThreshold(PoolIt.ObjectClass);
+		const int32 FirstReportIndex = OutReport.Num();
+
+		for (const FPoolObjectData& DataIt : PoolIt.PoolObjects)
+		{
+			const double AgeSeconds = CurrentTime - DataIt.LastStateChangeTime;
+			if (!DataIt.IsActive()
+			    || AgeSeconds < LeakThreshold)
+			{
+				continue;
+			}
+
+			// Find the group of this call site among groups of this pool
+			FPoolLeakReport* Report = nullptr;
+			for (int32 Index = FirstReportIndex; Index < OutReport.Num(); ++Index)
+			{
+				if (OutReport[Index].CallSiteId == DataIt.TakenCallSiteId)
+				{
+					Report = &OutReport[Index];
+					break;
+				}
+			}
+
+			if (!Report)
+			{
+				Report = &OutReport.AddDefaulted_GetRef();
+				Report->ObjectClass = PoolIt.ObjectClass;
+				Report->CallSiteId = DataIt.TakenCallSiteId;
+			}
+
+			++Report->ObjectsNum;
+			Report->OldestAgeSeconds = FMath::Max(Report->OldestAgeSeconds, AgeSeconds);
+		}
+	}
+
+	OutReport.Sort([](const FPoolLeakReport& A, const FPoolLeakReport& B) { return A.ObjectsNum > B.ObjectsNum; });
+}
+
+// Logs the leak report if there are suspected objects
+void UPoolManagerSubsystem::ScanForLeaks()
+{
+	TArray<FPoolLeakReport> Report;
+	GetLeakReport(/*out*/ Report);
+	if (Report.IsEmpty())
+	{
+		return;
+	}
+
+	UE_LOG(LogPoolManager, Warning, TEXT("Suspected leaks of pooled objects that are taken and never returned in '%s':"), *GetNameSafe(GetWorld()));
+	for (const FPoolLeakReport& It : Report)
+	{
+		UE_LOG(LogPoolManager, Warning, TEXT("  %s x%i (oldest %.1f s): %s"),
+		       *GetNameSafe(It.ObjectClass.Get()), It.ObjectsNum, It.OldestAgeSeconds, *DescribeCallSite(It.CallSiteId));
+	}
+}
+
+/*********************************************************************************************
+ * Getters
+ ********************************************************************************************* */
+
+// Returns current state of specified object
+EPoolObjectState UPoolManagerSubsystem::GetPoolObjectState_Implementation(const UObject* Object) const
+{
+	const UClass* ObjectClass = Object ? Object->GetClass() : nullptr;
+	const FPoolContainer* Pool = FindPool(ObjectClass);
+	const FPoolObjectData* PoolObject = Pool ? Pool->FindInPool(*Object) : nullptr;
+
+	if (!PoolObject
+	    || !PoolObject->IsValid())
+	{
+		// Is not contained in any pool
+		return EPoolObjectState::None;
+	}
+
+	return PoolObject->GetState();
+}
+
+// Returns true is specified object is handled by Pool Manager
+bool UPoolManagerSubsystem::ContainsObjectInPool_Implementation(const UObject* Object) const
+{
+	return GetPoolObjectState(Object) != EPoolObjectState::None;
+}
+
+bool UPoolManagerSubsystem::ContainsClassInPool_Implementation(const UClass* ObjectClass) const
+{
+	return FindPool(ObjectClass) != nullptr;
+}
+
+// Returns true if specified object is handled by the Pool Manager and was taken from its pool
+bool UPoolManagerSubsystem::IsActive_Implementation(const UObject* Object) const
+{
+	return GetPoolObjectState(Object) == EPoolObjectState::Active;
+}
+
+// Returns true if handled object is inactive and ready to be taken from pool
+bool UPoolManagerSubsystem::IsFreeObjectInPool_Implementation(const UObject* Object) const
+{
+	const UClass* ObjectClass = Object ? Object->GetClass() : nullptr;
+	const FPoolContainer* Pool = FindPool(ObjectClass);
+	const FPoolObjectData* PoolObject = Pool ? Pool->FindInPool(*Object) : nullptr;
+
+	// Both hot and cold objects are free
+	return PoolObject && PoolObject->IsFree();
+}
+
+// Returns number of free objects in pool by specified class
+int32 UPoolManagerSubsystem::GetFreeObjectsNum_Implementation(const UClass* ObjectClass) const
+{
+	const FPoolContainer* Pool = FindPool(ObjectClass);
+	if (!Pool)
+	{
+		return 0;
+	}
+
+	int32 FreeObjectsNum = 0;
+	for (const FPoolObjectData& PoolObjectIt : Pool->PoolObjects)
+	{
+		if (PoolObjectIt.IsFree())
 		{
 			++FreeObjectsNum;
 		}
@@ -704,11 +1476,168 @@ int32 UPoolManagerSubsystem::GetRegisteredObjectsNum_Implementation(const UClass
 	return RegisteredObjectsNum;
 }
 
+// Returns classes of all pools that are handled by the Pool Manager
+void UPoolManagerSubsystem::GetPoolClasses(TArray<const UClass*>& OutClasses) const
+{
+	OutClasses.Reserve(OutClasses.Num() + Pools.Num());
+	for (const FPoolContainer& PoolIt : Pools)
+	{
+		if (PoolIt.ObjectClass)
+		{
+			OutClasses.Emplace(PoolIt.ObjectClass);
+		}
+	}
+}
+
+// Returns estimated memory in bytes used by a pool by given class: its objects and bookkeeping
+int64 UPoolManagerSubsystem::GetPoolMemoryBytes(const UClass* ObjectClass) const
+{
+	const FPoolContainer* Pool = FindPool(ObjectClass);
+	return Pool ? GetPoolObjectsMemoryBytes(*Pool) + Pool->GetAllocatedSize() : 0;
+}
+
+// Returns estimated memory in bytes used by all objects of a pool: their own size and resources they own
+int64 UPoolManagerSubsystem::GetPoolObjectsMemoryBytes(const FPoolContainer& Pool)
+{
+	int64 MemoryBytes = 0;
+	for (const FPoolObjectData& PoolObjectIt : Pool.PoolObjects)
+	{
+		if (const UObject* Object = PoolObjectIt.Get())
+		{
+			MemoryBytes += Object->GetClass()->GetStructureSize();
+			MemoryBytes += Object->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+		}
+	}
+	return MemoryBytes;
+}
+
+// Returns estimated memory in bytes used by all pools and their bookkeeping
+int64 UPoolManagerSubsystem::GetTotalMemoryBytes() const
+{
+	int64 MemoryBytes = Pools.GetAllocatedSize() + CallSites.GetAllocatedSize();
+	for (const FPoolContainer& PoolIt : Pools)
+	{
+		// The container itself is already counted by the array allocation
+		MemoryBytes += GetPoolObjectsMemoryBytes(PoolIt) + PoolIt.GetAllocatedSize() - sizeof(FPoolContainer);
+	}
+
+	for (const TTuple<uint32, FPoolCallSite>& It : CallSites)
+	{
+		MemoryBytes += It.Value.GetAllocatedSize();
+	}
+
+	MemoryBytes += GetSnapshotsMemoryBytes();
+
+	return MemoryBytes;
+}
+
+// Returns memory in bytes of a pool by given class as it was estimated the last time
+int64 UPoolManagerSubsystem::GetEstimatedPoolMemoryBytes(const UClass* ObjectClass) const
+{
+	const int64* MemoryBytes = EstimatedPoolsMemoryBytes.Find(ObjectClass);
+	return MemoryBytes ? *MemoryBytes : 0;
+}
+
+// Refreshes estimated memory of all pools if the estimate is older than given interval in seconds
+void UPoolManagerSubsystem::UpdateMemoryEstimates(double Interval)
+{
+	const double CurrentTime = FPlatformTime::Seconds();
+	if (CurrentTime - LastMemoryEstimateTime < Interval)
+	{
+		return;
+	}
+	LastMemoryEstimateTime = CurrentTime;
+
+	EstimatedPoolsMemoryBytes.Reset();
+	EstimatedTotalMemoryBytes = Pools.GetAllocatedSize() + CallSites.GetAllocatedSize();
+	for (const FPoolContainer& PoolIt : Pools)
+	{
+		// Objects of the same class have roughly the same size, so only the first valid one is measured
+		int64 ObjectBytes = 0;
+		for (const FPoolObjectData& PoolObjectIt : PoolIt.PoolObjects)
+		{
+			if (const UObject* Object = PoolObjectIt.Get())
+			{
+				ObjectBytes = Object->GetClass()->GetStructureSize() + Object->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+				break;
+			}
+		}
+
+		const int64 PoolBytes = ObjectBytes * PoolIt.PoolObjects.Num() + PoolIt.GetAllocatedSize();
+		EstimatedPoolsMemoryBytes.Add(PoolIt.ObjectClass, PoolBytes);
+
+		// The container itself is already counted by the array allocation
+		EstimatedTotalMemoryBytes += PoolBytes - sizeof(FPoolContainer);
+	}
+
+	for (const TTuple<uint32, FPoolCallSite>& It : CallSites)
+	{
+		EstimatedTotalMemoryBytes += It.Value.GetAllocatedSize();
+	}
+
+	EstimatedTotalMemoryBytes += GetSnapshotsMemoryBytes();
+}
+
+// Returns number of objects of all classes that are requested to be spawned, but are not spawned yet
+int32 UPoolManagerSubsystem::GetSpawnQueueNum() const
+{
+	int32 SpawnQueueNum = 0;
+	for (const TTuple<TObjectPtr<const UClass>, TObjectPtr<UPoolFactory_UObject>>& FactoryIt : AllFactories)
+	{
+		SpawnQueueNum += FactoryIt.Value ? FactoryIt.Value->GetSpawnQueueNum() : 0;
+	}
+	return SpawnQueueNum;
+}
+
+// Returns the histogram of latencies between requesting the spawn and receiving the spawned object
+FPoolSpawnLatencyHistogram UPoolManagerSubsystem::GetSpawnLatency(const UClass* ObjectClass/* = nullptr*/, ESpawnRequestPriority Priority/* = ESpawnRequestPriority::None*/) const
+{
+	if (ObjectClass)
+	{
+		return FindPoolFactoryChecked(ObjectClass)->GetSpawnLatency(ObjectClass, Priority);
+	}
+
+	// The same factory can handle multiple classes, so merge each factory only once
+	TSet<const UPoolFactory_UObject*> MergedFactories;
+	FPoolSpawnLatencyHistogram Result;
+	for (const TTuple<TObjectPtr<const UClass>, TObjectPtr<UPoolFactory_UObject>>& FactoryIt : AllFactories)
+	{
+		const UPoolFactory_UObject* Factory = FactoryIt.Value;
+		if (Factory && !MergedFactories.Contains(Factory))
+		{
+			MergedFactories.Emplace(Factory);
+			Result.Append(Factory->GetSpawnLatency(nullptr, Priority));
+		}
+	}
+	return Result;
+}
+
+// Returns the last spawns of all factories that took longer than their 'Spawn Hitch Threshold Ms'
+void UPoolManagerSubsystem::GetRecentSpawnHitches(TArray<FPoolSpawnHitch>& OutHitches) const
+{
+	TSet<const UPoolFactory_UObject*> CollectedFactories;
+	for (const TTuple<TObjectPtr<const UClass>, TObjectPtr<UPoolFactory_UObject>>& FactoryIt : AllFactories)
+	{
+		const UPoolFactory_UObject* Factory = FactoryIt.Value;
+		if (Factory && !CollectedFactories.Contains(Factory))
+		{
+			CollectedFactories.Emplace(Factory);
+			OutHitches.Append(Factory->GetRecentSpawnHitches());
+		}
+	}
+
+	OutHitches.Sort([](const FPoolSpawnHitch& A, const FPoolSpawnHitch& B) { return A.FrameNumber > B.FrameNumber; });
+}
+
 // Returns the object associated with given handle
 const FPoolObjectData& UPoolManagerSubsystem::FindPoolObjectByHandle(const FPoolObjectHandle& Handle) const
 {
-	const FPoolContainer* Pool = FindPool(Handle.GetObjectClass());
-	const FPoolObjectData* ObjectData = Pool ? Pool->FindInPool(Handle) : nullptr;
+	// Handles reserved by TakeFromPoolSoft() are resolved to the handle of the object, it is empty while the class is loading
+	const FPoolSoftTake* SoftTake = SoftTakes.Find(Handle);
+	const FPoolObjectHandle& ObjectHandle = SoftTake ? SoftTake->ObjectHandle : Handle;
+
+	const FPoolContainer* Pool = ObjectHandle.IsValid() ? FindPool(ObjectHandle.GetObjectClass()) : nullptr;
+	const FPoolObjectData* ObjectData = Pool ? Pool->FindInPool(ObjectHandle) : nullptr;
 	return ObjectData ? *ObjectData : FPoolObjectData::EmptyObject;
 }
 
@@ -733,6 +1662,302 @@ void UPoolManagerSubsystem::FindPoolObjectsByHandles(TArray<FPoolObjectData>& Ou
 	}
 }
 
+// Iterates all valid objects of a pool by specified class, both free and taken
+void UPoolManagerSubsystem::ForEachObjectInPool(const UClass* ObjectClass, const TFunctionRef<void(const FPoolObjectData&)> Callback) const
+{
+	const FPoolContainer* Pool = FindPool(ObjectClass);
+	if (!Pool)
+	{
+		return;
+	}
+
+	for (const FPoolObjectData& PoolObjectIt : Pool->PoolObjects)
+	{
+		if (PoolObjectIt.IsValid())
+		{
+			Callback(PoolObjectIt);
+		}
+	}
+}
+
+/*********************************************************************************************
+ * Thread-Safe Getters
+ ********************************************************************************************* */
+
+// Returns the frame number of the last published snapshot or 0 if nothing is published yet
+uint64 UPoolManagerSubsystem::GetSnapshotFrameNumber() const
+{
+	const FPoolSnapshotPtr Snapshot = GetPublishedSnapshot();
+	return Snapshot.IsValid() ? Snapshot->FrameNumber : 0;
+}
+
+// Is thread-safe alternative to GetPoolObjectState()
+EPoolObjectState UPoolManagerSubsystem::GetPoolObjectStateThreadSafe(const UObject* Object) const
+{
+	const FPoolSnapshotPtr Snapshot = GetPublishedSnapshot();
+	const EPoolObjectState* FoundState = Snapshot.IsValid() && Object ? Snapshot->ObjectStates.Find(Object) : nullptr;
+	return FoundState ? *FoundState : EPoolObjectState::None;
+}
+
+// Is thread-safe alternative to IsActive()
+bool UPoolManagerSubsystem::IsActiveThreadSafe(const UObject* Object) const
+{
+	return GetPoolObjectStateThreadSafe(Object) == EPoolObjectState::Active;
+}
+
+// Is thread-safe alternative to IsRegistered()
+bool UPoolManagerSubsystem::IsRegisteredThreadSafe(const UObject* Object) const
+{
+	return GetPoolObjectStateThreadSafe(Object) != EPoolObjectState::None;
+}
+
+// Returns counters of the pool by specified class, can be called from any thread
+FPoolClassSnapshot UPoolManagerSubsystem::GetPoolSnapshotThreadSafe(const UClass* ObjectClass) const
+{
+	const FPoolSnapshotPtr Snapshot = GetPublishedSnapshot();
+	const FPoolClassSnapshot* FoundPool = Snapshot.IsValid() && ObjectClass ? Snapshot->Pools.Find(ObjectClass) : nullptr;
+	return FoundPool ? *FoundPool : FPoolClassSnapshot();
+}
+
+// Reads the whole last published snapshot at once, can be called from any thread
+void UPoolManagerSubsystem::ReadSnapshot(const TFunctionRef<void(const FPoolSnapshot&)> Callback) const
+{
+	static const FPoolSnapshot EmptySnapshot;
+
+	// Holding the reference keeps the snapshot alive while the callback reads it
+	const FPoolSnapshotPtr Snapshot = GetPublishedSnapshot();
+	Callback(Snapshot.IsValid() ? *Snapshot : EmptySnapshot);
+}
+
+// Returns the last published snapshot or null if nothing is published yet, can be called from any thread
+FPoolSnapshotPtr UPoolManagerSubsystem::GetPublishedSnapshot() const
+{
+	// Is counted before loading the pointer, so the publisher does not release the snapshot until its reference is taken
+	++SnapshotReadersNum;
+	const FPoolSnapshot* Snapshot = PublishedSnapshotPtr.load();
+	FPoolSnapshotPtr SnapshotRef = Snapshot ? FPoolSnapshotPtr(Snapshot->AsShared()) : nullptr;
+	--SnapshotReadersNum;
+
+	return SnapshotRef;
+}
+
+// Copies the current state of all pools into new snapshot and publishes it
+void UPoolManagerSubsystem::PublishSnapshot()
+{
+	POOL_MANAGER_SCOPE_CYCLE_COUNTER(STAT_PoolManager_PublishSnapshot);
+	LLM_SCOPE_BYTAG(PoolManager);
+
+	check(IsInGameThread());
+
+	// Published snapshots are never modified, so reuse the released one only if no reader holds it anymore:
+	// once it is unique, it can't be referenced again, since it is not published
+	TSharedPtr<FPoolSnapshot, ESPMode::ThreadSafe> NewSnapshot = MoveTemp(ReusableSnapshot);
+	if (NewSnapshot.IsValid() && NewSnapshot.IsUnique())
+	{
+		NewSnapshot->Reset();
+	}
+	else
+	{
+		NewSnapshot = MakeShared<FPoolSnapshot, ESPMode::ThreadSafe>();
+	}
+
+	FPoolSnapshot& Snapshot = *NewSnapshot;
+	Snapshot.FrameNumber = GFrameCounter;
+
+	for (const FPoolContainer& PoolIt : Pools)
+	{
+		FPoolClassSnapshot& PoolSnapshot = Snapshot.Pools.Add(PoolIt.ObjectClass);
+		PoolSnapshot.ActiveObjectsNum = PoolIt.ActiveObjects.Num();
+		PoolSnapshot.SpawnQueueNum = PoolIt.Factory ? PoolIt.Factory->GetSpawnQueueNum(PoolIt.ObjectClass) : 0;
+
+		for (const FPoolObjectData& DataIt : PoolIt.PoolObjects)
+		{
+			if (!DataIt.IsValid())
+			{
+				continue;
+			}
+
+			++PoolSnapshot.RegisteredObjectsNum;
+			if (DataIt.IsFree())
+			{
+				++PoolSnapshot.FreeObjectsNum;
+				PoolSnapshot.ColdObjectsNum += DataIt.bIsCold ? 1 : 0;
+			}
+
+			Snapshot.ObjectStates.Add(DataIt.PoolObject, DataIt.GetState());
+		}
+	}
+
+	// Readers could load the pointer of the previous snapshot right before the swap, so it is released later
+	PublishedSnapshotPtr.store(NewSnapshot.Get());
+	if (PublishedSnapshot.IsValid())
+	{
+		RetiredSnapshots.Emplace(MoveTemp(PublishedSnapshot));
+	}
+	PublishedSnapshot = MoveTemp(NewSnapshot);
+
+	ReleaseRetiredSnapshots();
+}
+
+// Releases retired snapshots if no reader is taking the reference to the published snapshot right now
+void UPoolManagerSubsystem::ReleaseRetiredSnapshots()
+{
+	check(IsInGameThread());
+
+	// Every reader that loaded the pointer of a retired snapshot is counted until it takes the reference,
+	// so if none is counted after the swap, retired snapshots are either referenced by readers or can't be reached anymore
+	if (RetiredSnapshots.IsEmpty()
+	    || SnapshotReadersNum.load() != 0)
+	{
+		return;
+	}
+
+	for (TSharedPtr<FPoolSnapshot, ESPMode::ThreadSafe>& It : RetiredSnapshots)
+	{
+		if (!ReusableSnapshot.IsValid()
+		    && It.IsUnique())
+		{
+			ReusableSnapshot = MoveTemp(It);
+		}
+	}
+
+	// Snapshots that are still read are freed by their last reader
+	RetiredSnapshots.Reset();
+}
+
+// Returns memory in bytes used by published, retired and reusable snapshots
+int64 UPoolManagerSubsystem::GetSnapshotsMemoryBytes() const
+{
+	int64 MemoryBytes = RetiredSnapshots.GetAllocatedSize();
+
+	// Snapshots are swapped only on the game thread, so they can be read here
+	const auto AddSnapshotBytes = [&MemoryBytes](const FPoolSnapshot* Snapshot)
+	{
+		MemoryBytes += Snapshot ? sizeof(FPoolSnapshot) + Snapshot->Pools.GetAllocatedSize() + Snapshot->ObjectStates.GetAllocatedSize() : 0;
+	};
+
+	AddSnapshotBytes(PublishedSnapshot.Get());
+	AddSnapshotBytes(ReusableSnapshot.Get());
+	for (const TSharedPtr<FPoolSnapshot, ESPMode::ThreadSafe>& It : RetiredSnapshots)
+	{
+		AddSnapshotBytes(It.Get());
+	}
+
+	return MemoryBytes;
+}
+
+// Is bound to update pool tiers and publish the snapshot at the end of world tick
+void UPoolManagerSubsystem::OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World != GetWorld())
+	{
+		return;
+	}
+
+	const UPoolManagerSettings& Settings = UPoolManagerSettings::Get();
+
+	SET_DWORD_STAT(STAT_PoolManager_SpawnQueueDepth, GetSpawnQueueNum());
+
+#if STATS
+	// Stats are collected only while shown or captured, and even then memory is estimated once per second, since it visits the pools
+	if (FThreadStats::IsCollectingData())
+	{
+		UpdateMemoryEstimates(1.0);
+		SET_MEMORY_STAT(STAT_PoolManager_PooledMemory, GetEstimatedTotalMemoryBytes());
+	}
+#endif // STATS
+
+	if (Settings.IsColdTierEnabled())
+	{
+		UpdatePoolTiers();
+	}
+
+	if (Settings.ShouldPublishSnapshots())
+	{
+		PublishSnapshot();
+	}
+
+	if (Settings.ShouldDetectLeaks())
+	{
+		const double CurrentTime = FPlatformTime::Seconds();
+		if (CurrentTime - LastLeakScanTime >= Settings.GetLeakScanInterval())
+		{
+			LastLeakScanTime = CurrentTime;
+			ScanForLeaks();
+		}
+	}
+
+	RecordCsvStats();
+}
+
+// Records hit rate, spawn queue, spawns, returns and memory of the last frame to the CSV profiler
+void UPoolManagerSubsystem::RecordCsvStats()
+{
+#if CSV_PROFILER
+	const FCsvProfiler* CsvProfiler = FCsvProfiler::Get();
+	if (!CsvProfiler
+	    || !CsvProfiler->IsCapturing())
+	{
+		CsvRecordedCounters = Counters;
+		return;
+	}
+
+	const FPoolManagerCounters FrameCounters = Counters - CsvRecordedCounters;
+	CsvRecordedCounters = Counters;
+
+	CSV_CUSTOM_STAT(PoolManager, HitRate, static_cast<float>(FrameCounters.GetHitRate()), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(PoolManager, Hits, static_cast<int32>(FrameCounters.HitsNum), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(PoolManager, Misses, static_cast<int32>(FrameCounters.MissesNum), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(PoolManager, Spawns, static_cast<int32>(FrameCounters.SpawnsNum), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(PoolManager, Returns, static_cast<int32>(FrameCounters.ReturnsNum), ECsvCustomStatOp::Set);
+
+	int32 SpawnQueueNormal = 0;
+	int32 SpawnQueueMedium = 0;
+	int32 SpawnQueueHigh = 0;
+	for (const TTuple<TObjectPtr<const UClass>, TObjectPtr<UPoolFactory_UObject>>& FactoryIt : AllFactories)
+	{
+		if (const UPoolFactory_UObject* Factory = FactoryIt.Value)
+		{
+			SpawnQueueNormal += Factory->GetSpawnQueueNumByPriority(ESpawnRequestPriority::Normal);
+			SpawnQueueMedium += Factory->GetSpawnQueueNumByPriority(ESpawnRequestPriority::Medium);
+			SpawnQueueHigh += Factory->GetSpawnQueueNumByPriority(ESpawnRequestPriority::High);
+		}
+	}
+	CSV_CUSTOM_STAT(PoolManager, SpawnQueueNormal, SpawnQueueNormal, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(PoolManager, SpawnQueueMedium, SpawnQueueMedium, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(PoolManager, SpawnQueueHigh, SpawnQueueHigh, ECsvCustomStatOp::Set);
+
+	// Walking all objects every frame would skew frame times being captured, so the estimate refreshed once per second is recorded instead
+	UpdateMemoryEstimates(1.0);
+	CSV_CUSTOM_STAT(PoolManager, MemoryKB, static_cast<float>(GetEstimatedTotalMemoryBytes() / 1024.0), ECsvCustomStatOp::Set);
+
+	if (!CVarPoolManagerCsvPerClassStats.GetValueOnGameThread())
+	{
+		return;
+	}
+
+	for (const FPoolContainer& PoolIt : Pools)
+	{
+		const UClass* ObjectClass = PoolIt.ObjectClass;
+		if (!ObjectClass)
+		{
+			continue;
+		}
+
+		const int32 FreeNum = GetFreeObjectsNum(ObjectClass);
+		const int32 ActiveNum = GetRegisteredObjectsNum(ObjectClass) - FreeNum;
+		const int32 QueuedNum = PoolIt.GetFactoryChecked().GetSpawnQueueNum(ObjectClass);
+		const uint32 CategoryIndex = CSV_CATEGORY_INDEX(PoolManagerClasses);
+		const FString ClassName = ObjectClass->GetName();
+
+		FCsvProfiler::RecordCustomStat(FName(*(ClassName + TEXT("/Free"))), CategoryIndex, FreeNum, ECsvCustomStatOp::Set);
+		FCsvProfiler::RecordCustomStat(FName(*(ClassName + TEXT("/Active"))), CategoryIndex, ActiveNum, ECsvCustomStatOp::Set);
+		FCsvProfiler::RecordCustomStat(FName(*(ClassName + TEXT("/Queued"))), CategoryIndex, QueuedNum, ECsvCustomStatOp::Set);
+		FCsvProfiler::RecordCustomStat(FName(*(ClassName + TEXT("/MemoryKB"))), CategoryIndex, static_cast<float>(GetEstimatedPoolMemoryBytes(ObjectClass) / 1024.0), ECsvCustomStatOp::Set);
+	}
+#endif // CSV_PROFILER
+}
+
 /*********************************************************************************************
  * Protected methods
  ********************************************************************************************* */
@@ -744,6 +1969,9 @@ void UPoolManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 	InitializeAllFactories();
 
+	FWorldDelegates::OnWorldTickStart.AddUObject(this, &ThisClass::OnWorldTickStart);
+	FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &ThisClass::OnWorldPostActorTick);
+
 #if WITH_EDITOR
 	if (GEditor
 	    && !GEditor->IsPlaySessionInProgress() // Is Editor and not in PIE
@@ -777,6 +2005,19 @@ void UPoolManagerSubsystem::Deinitialize()
 {
 	Super::Deinitialize();
 
+	FWorldDelegates::OnWorldTickStart.RemoveAll(this);
+	FWorldDelegates::OnWorldPostActorTick.RemoveAll(this);
+	PublishedSnapshotPtr.store(nullptr);
+	PublishedSnapshot.Reset();
+	RetiredSnapshots.Empty();
+	ReusableSnapshot.Reset();
+	SoftTakes.Empty();
+
+	if (BatchTickFunction.IsTickFunctionRegistered())
+	{
+		BatchTickFunction.UnRegisterTickFunction();
+	}
+
 	ClearAllFactories();
 }
 
@@ -790,9 +2031,18 @@ FPoolContainer& UPoolManagerSubsystem::FindPoolOrAdd(const UClass* ObjectClass)
 		return *Pool;
 	}
 
+	LLM_SCOPE_BYTAG(PoolManager);
+
 	FPoolContainer& Pool = Pools.AddDefaulted_GetRef();
 	Pool.ObjectClass = ObjectClass;
 	Pool.Factory = FindPoolFactoryChecked(ObjectClass);
+	Pool.bBatchTick = ObjectClass->ImplementsInterface(UPoolObjectBatchTick::StaticClass());
+
+	if (Pool.bBatchTick)
+	{
+		RegisterBatchTickFunction();
+	}
+
 	return Pool;
 }
 
@@ -810,13 +2060,46 @@ FPoolContainer* UPoolManagerSubsystem::FindPool(const UClass* ObjectClass)
 // Activates or deactivates the object if such object is handled by the Pool Manager
 void UPoolManagerSubsystem::SetObjectStateInPool(EPoolObjectState NewState, UObject& InObject, FPoolContainer& InPool)
 {
+	POOL_MANAGER_SCOPE_CYCLE_COUNTER(STAT_PoolManager_SetObjectState);
+
 	FPoolObjectData* PoolObject = InPool.FindInPool(InObject);
 	if (!ensureMsgf(PoolObject && PoolObject->IsValid(), TEXT("ASSERT: [%i] %hs:\n'PoolObject' is not registered in given pool for class: %s"), __LINE__, __FUNCTION__, *GetNameSafe(InPool.ObjectClass)))
 	{
 		return;
 	}
 
+	const bool bWasActive = PoolObject->bIsActive;
 	PoolObject->bIsActive = NewState == EPoolObjectState::Active;
+	PoolObject->bIsCold = NewState == EPoolObjectState::Cold;
+	PoolObject->LastStateChangeTime = FPlatformTime::Seconds();
+
+	// Keep the dense list of active objects in sync
+	if (PoolObject->bIsActive && !bWasActive)
+	{
+		InPool.ActiveObjects.Emplace(&InObject);
+	}
+	else if (!PoolObject->bIsActive && bWasActive)
+	{
+		InPool.ActiveObjects.RemoveSwap(&InObject);
+
+		// The reserved handle belongs only to the take it was reserved for
+		SoftTakes.Remove(PoolObject->ReservedHandle);
+		PoolObject->ReservedHandle = FPoolObjectHandle::EmptyHandle;
+	}
+
+	// Objects that are returned while batched pools are ticked should not be ticked anymore in this frame
+	if (bIsBatchTicking)
+	{
+		if (PoolObject->bIsActive)
+		{
+			ReturnedWhileBatchTicking.Remove(&InObject);
+		}
+		else
+		{
+			ReturnedWhileBatchTicking.Emplace(&InObject);
+		}
+	}
 
+	POOL_MANAGER_SCOPE_CYCLE_COUNTER(STAT_PoolManager_FactoryOnChangedState);
 	InPool.GetFactoryChecked().OnChangedStateInPool(NewState, &InObject);
 }
@@ -0,0 +1,95 @@
+// Copyright (c) Yevhenii Selivanov
+
+#include "PoolManagerTrace.h"
+
+// Pool Manager
+#include "Data/PoolObjectHandle.h"
+
+// UE
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/Class.h"
+
+#if POOL_MANAGER_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_DEFINE(PoolManagerChannel);
+
+UE_TRACE_EVENT_BEGIN(PoolManager, ClassInfo, NoSync | Important)
+	UE_TRACE_EVENT_FIELD(uint32, ClassId)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Name)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(PoolManager, ObjectEvent)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, HandleId)
+	UE_TRACE_EVENT_FIELD(uint32, ClassId)
+	UE_TRACE_EVENT_FIELD(uint32, FrameNumber)
+	UE_TRACE_EVENT_FIELD(uint8, Event)
+	UE_TRACE_EVENT_FIELD(uint8, Priority)
+UE_TRACE_EVENT_END()
+
+#endif // POOL_MANAGER_TRACE_ENABLED
+
+// Emits the lifecycle event of the object by its handle
+void FPoolManagerTrace::OutputObjectEvent(EPoolObjectTraceEvent Event, const FPoolObjectHandle& Handle, ESpawnRequestPriority Priority /* = ESpawnRequestPriority::Normal*/)
+{
+#if POOL_MANAGER_TRACE_ENABLED
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(PoolManagerChannel))
+	{
+		return;
+	}
+
+	const uint32 ClassId = OutputClass(Handle.GetObjectClass());
+
+	// Fold the guid into single 64-bit id to keep events compact
+	const FGuid& Hash = Handle.GetHash();
+	const uint64 HandleId = ((static_cast<uint64>(Hash.A) << 32) | Hash.B) ^ ((static_cast<uint64>(Hash.C) << 32) | Hash.D);
+
+	UE_TRACE_LOG(PoolManager, ObjectEvent, PoolManagerChannel)
+		<< ObjectEvent.Cycle(FPlatformTime::Cycles64())
+		<< ObjectEvent.HandleId(HandleId)
+		<< ObjectEvent.ClassId(ClassId)
+		<< ObjectEvent.FrameNumber(static_cast<uint32>(GFrameCounter))
+		<< ObjectEvent.Event(static_cast<uint8>(Event))
+		<< ObjectEvent.Priority(static_cast<uint8>(Priority));
+#endif // POOL_MANAGER_TRACE_ENABLED
+}
+
+// Emits the name of the class once and returns its compact id, so events can refer to the class by it
+uint32 FPoolManagerTrace::OutputClass(const UClass* ObjectClass)
+{
+#if POOL_MANAGER_TRACE_ENABLED
+	if (!ObjectClass
+	    || !UE_TRACE_CHANNELEXPR_IS_ENABLED(PoolManagerChannel))
+	{
+		return 0;
+	}
+
+	// Unique ids of objects are reused after garbage collection, so classes are keyed with their serial numbers
+	// and get own ids that are never reused, events can be emitted from worker threads, so it is guarded
+	static FCriticalSection TracedClassesSection;
+	static TMap<FObjectKey, uint32> TracedClassIds;
+	FScopeLock Lock(&TracedClassesSection);
+
+	const FObjectKey ClassKey(ObjectClass);
+	if (const uint32* FoundClassId = TracedClassIds.Find(ClassKey))
+	{
+		return *FoundClassId;
+	}
+
+	const uint32 ClassId = TracedClassIds.Num() + 1;
+	TracedClassIds.Add(ClassKey, ClassId);
+
+	// Class info is important event, so it is cached by the trace and sent to late connected sessions as well
+	// Is emitted under the lock, so no event can refer to the class before its info
+	const FString ClassName = ObjectClass->GetPathName();
+	UE_TRACE_LOG(PoolManager, ClassInfo, PoolManagerChannel, ClassName.Len() * sizeof(TCHAR))
+		<< ClassInfo.ClassId(ClassId)
+		<< ClassInfo.Name(*ClassName, ClassName.Len());
+
+	return ClassId;
+#else
+	return 0;
+#endif // POOL_MANAGER_TRACE_ENABLED
+}
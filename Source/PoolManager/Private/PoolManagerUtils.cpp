@@ -5,7 +5,7 @@
 #include UE_INLINE_GENERATED_CPP_BY_NAME(PoolManagerUtils)
 
 // Creates a spawn request for pool objects
-FSpawnRequest UPoolManagerUtils::MakeSpawnRequest(TSubclassOf<UObject> ObjectClass, const FTransform& Transform, ESpawnRequestPriority Priority/* = ESpawnRequestPriority::Normal*/)
+FSpawnRequest UPoolManagerUtils::MakeSpawnRequest(TSubclassOf<UObject> ObjectClass, const FTransform& Transform, ESpawnRequestPriority Priority/* = ESpawnRequestPriority::Normal*/, FName VariantKey/* = NAME_None*/)
 {
 	if (!ensureMsgf(ObjectClass, TEXT("ASSERT: [%i] %hs:\n'ObjectClass' is null, can't create spawn request!"), __LINE__, __FUNCTION__))
 	{
@@ -15,5 +15,6 @@ FSpawnRequest UPoolManagerUtils::MakeSpawnRequest(TSubclassOf<UObject> ObjectCla
 	FSpawnRequest Request(ObjectClass);
 	Request.Transform = Transform;
 	Request.Priority = Priority;
+	Request.VariantKey = VariantKey;
 	return Request;
 }
@@ -0,0 +1,75 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Widgets/PooledListEntryGenerator.h"
+
+// Pool Manager
+#include "PoolManagerSubsystem.h"
+#include "Data/PoolObjectHandle.h"
+
+// UE
+#include "Blueprint/UserWidget.h"
+#include "Components/ListViewBase.h"
+#include "Slate/SObjectTableRow.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PooledListEntryGenerator)
+
+// Takes the entry widget of given class from the pool and wraps it into the table row of given list view
+UUserWidget& FPooledListEntryGenerator::GenerateEntry(UListViewBase& ListView, TSubclassOf<UUserWidget> EntryClass, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	checkf(EntryClass, TEXT("ERROR: [%i] %hs:\n'EntryClass' is null for %s!"), __LINE__, __FUNCTION__, *ListView.GetName());
+
+	// Critical priority creates new entry immediately if there are no free entries in the pool
+	UPoolManagerSubsystem& PoolManager = UPoolManagerSubsystem::Get(UPoolManagerSubsystem::StaticClass(), &ListView);
+	const FPoolObjectHandle Handle = PoolManager.TakeFromPool(EntryClass, FTransform::Identity, nullptr, ESpawnRequestPriority::Critical);
+	UUserWidget* EntryWidget = PoolManager.FindPoolObjectByHandle(Handle).Get<UUserWidget>();
+	checkf(EntryWidget, TEXT("ERROR: [%i] %hs:\n'EntryWidget' failed to be taken from the pool for %s!"), __LINE__, __FUNCTION__, *EntryClass->GetName());
+
+	// Entries are shared across screens, so always take the player of current list
+	EntryWidget->SetOwningPlayer(ListView.GetOwningPlayer());
+
+	// Is the same row as the list would create for its own entries, Slate resources are always released on return, so row is built anew
+	EntryWidget->TakeDerivedWidget<SObjectTableRow<UObject*>>([&OwnerTable, &ListView](UUserWidget* WidgetObject, TSharedRef<SWidget> Content)
+	{
+		return SNew(SObjectTableRow<UObject*>, OwnerTable, *WidgetObject, &ListView)
+			[
+				Content
+			];
+	});
+
+	PooledEntries.AddUnique(EntryWidget);
+	return *EntryWidget;
+}
+
+// Releases Slate resources of the entry widget and returns it back to the pool to be reused by any list view
+void FPooledListEntryGenerator::ReleaseEntry(UUserWidget& EntryWidget)
+{
+	if (PooledEntries.RemoveSingleSwap(&EntryWidget) > 0)
+	{
+		ReturnEntryToPool(EntryWidget);
+	}
+}
+
+// Returns all remaining entries back to the pool
+void FPooledListEntryGenerator::ReleaseAllEntries()
+{
+	TArray<TObjectPtr<UUserWidget>> EntriesToRelease = MoveTemp(PooledEntries);
+	for (UUserWidget* EntryIt : EntriesToRelease)
+	{
+		if (IsValid(EntryIt))
+		{
+			ReturnEntryToPool(*EntryIt);
+		}
+	}
+}
+
+// Releases Slate resources of the entry widget and returns it back to the pool
+void FPooledListEntryGenerator::ReturnEntryToPool(UUserWidget& EntryWidget)
+{
+	// The row is bound to the table of previous list view, so it has to be released to be reused by another list
+	EntryWidget.ReleaseSlateResources(/*bReleaseChildren*/ true);
+
+	if (UPoolManagerSubsystem* PoolManager = UPoolManagerSubsystem::GetPoolManager(&EntryWidget))
+	{
+		PoolManager->ReturnToPool(&EntryWidget);
+	}
+}
@@ -0,0 +1,37 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Widgets/PooledListView.h"
+
+// UE
+#include "Blueprint/UserWidget.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PooledListView)
+
+// Default constructor
+UPooledListView::UPooledListView(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+	OnEntryWidgetReleased().AddUObject(this, &ThisClass::OnPooledEntryReleased);
+}
+
+// Is overridden to return all remaining entries back to the Pool Manager
+void UPooledListView::ReleaseSlateResources(bool bReleaseChildren)
+{
+	Super::ReleaseSlateResources(bReleaseChildren);
+
+	// Rows are destroyed together with the table without releasing their entries, so return them here
+	EntryGenerator.ReleaseAllEntries();
+}
+
+// Is overridden to take the entry widget from the Pool Manager
+UUserWidget& UPooledListView::OnGenerateEntryWidgetInternal(UObject* Item, TSubclassOf<UUserWidget> DesiredEntryClass, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	// Super is not called to take the entry from the Pool Manager instead of own pool
+	return EntryGenerator.GenerateEntry(*this, DesiredEntryClass, OwnerTable);
+}
+
+// Is bound to return released entry widget back to the Pool Manager
+void UPooledListView::OnPooledEntryReleased(UUserWidget& EntryWidget)
+{
+	EntryGenerator.ReleaseEntry(EntryWidget);
+}
@@ -0,0 +1,38 @@
+// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "Engine/EngineBaseTypes.h"
+
+#include "PoolBatchTickFunction.generated.h"
+
+/**
+ * Is the single tick function of the Pool Manager that ticks all active objects of batched pools at once.
+ * @see IPoolObjectBatchTick
+ */
+USTRUCT()
+struct POOLMANAGER_API FPoolBatchTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	/* Default constructor. */
+	FPoolBatchTickFunction();
+
+	/** The Pool Manager that owns this tick function. */
+	TWeakObjectPtr<class UPoolManagerSubsystem> PoolManager = nullptr;
+
+	/** Is overridden to tick all batched pools of the Pool Manager. */
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+
+	/** Is overridden to describe this tick function in debug messages. */
+	virtual FString DiagnosticMessage() override;
+};
+
+template <>
+struct TStructOpsTypeTraits<FPoolBatchTickFunction> : public TStructOpsTypeTraitsBase2<FPoolBatchTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
@@ -38,6 +38,14 @@ struct POOLMANAGER_API FPoolContainer
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Transient)
 	TArray<FPoolObjectData> PoolObjects;
 
+	/** Dense list of objects in this pool that are currently taken from the pool, is fast to iterate. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Transient)
+	TArray<TObjectPtr<UObject>> ActiveObjects;
+
+	/** Is true if objects of this pool implement IPoolObjectBatchTick, so they are ticked all at once by the Pool Manager. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Transient)
+	bool bBatchTick = false;
+
 	/** Returns the pointer to the Pool element by specified object. */
 	FPoolObjectData* FindInPool(const UObject& Object);
 	const FORCEINLINE FPoolObjectData* FindInPool(const UObject& Object) const { return const_cast<FPoolContainer*>(this)->FindInPool(Object); }
@@ -46,6 +54,9 @@ struct POOLMANAGER_API FPoolContainer
 	FPoolObjectData* FindInPool(const struct FPoolObjectHandle& Handle);
 	const FORCEINLINE FPoolObjectData* FindInPool(const struct FPoolObjectHandle& Handle) const { return const_cast<FPoolContainer*>(this)->FindInPool(Handle); }
 
+	/** Returns memory in bytes used by this container and its arrays, excluding pooled objects themselves. */
+	SIZE_T GetAllocatedSize() const { return sizeof(FPoolContainer) + PoolObjects.GetAllocatedSize() + ActiveObjects.GetAllocatedSize(); }
+
 	/** Returns factory or crashes as critical error if it is not set. */
 	class UPoolFactory_UObject& GetFactoryChecked() const;
 
@@ -0,0 +1,33 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "UObject/Object.h"
+
+// Pool Manager
+#include "Data/SpawnRequest.h"
+
+#include "PoolDeferredActorSpawn.generated.h"
+
+/**
+ * Is the actor that is spawned across multiple frames, SpawnActor and FinishSpawning are charged separately against the spawn budget:
+ * SpawnActor (deferred) -> FinishSpawning (construction script, BeginPlay) -> Register in the pool (is not charged).
+ * @see UPoolFactory_Actor::bSplitSpawnAcrossFrames
+ */
+USTRUCT(BlueprintType)
+struct POOLMANAGER_API FPoolDeferredActorSpawn
+{
+	GENERATED_BODY()
+
+	/** The request of this actor to be processed once all stages are complete. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Transient)
+	FSpawnRequest Request;
+
+	/** The spawned actor, its construction can be not finished yet. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Transient)
+	TObjectPtr<class AActor> Actor = nullptr;
+
+	/** Is true once FinishSpawning is called, so the actor is ready to be registered in the pool. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Transient)
+	bool bIsConstructed = false;
+};
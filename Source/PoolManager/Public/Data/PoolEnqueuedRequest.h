@@ -0,0 +1,28 @@
+// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+// Pool Manager
+#include "Data/SpawnRequest.h"
+
+/**
+ * Is the request to take or return an object that is enqueued from any thread.
+ * Is processed by the Pool Manager on the game thread at the start of next world tick.
+ */
+struct POOLMANAGER_API FPoolEnqueuedRequest
+{
+	/** Types of enqueued requests. */
+	enum class EType : uint8
+	{
+		///< Take the object from the pool or spawn new one, the handle is already reserved in the request
+		Take,
+		///< Return the object by the handle of the request to the pool
+		Return
+	};
+
+	/** Type of this request. */
+	EType Type = EType::Take;
+
+	/** The request with the reserved handle, transform, priority and callbacks. */
+	FSpawnRequest Request;
+};
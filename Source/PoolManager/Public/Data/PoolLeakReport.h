@@ -0,0 +1,44 @@
+// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "UObject/Object.h"
+
+/**
+ * Groups objects that are taken from the pool for longer than expected by their class and the place they were taken from.
+ * @see UPoolManagerSubsystem::GetLeakReport
+ */
+struct POOLMANAGER_API FPoolLeakReport
+{
+	/** Class of suspected objects. */
+	TWeakObjectPtr<const UClass> ObjectClass = nullptr;
+
+	/** Id of the call site where suspected objects were taken, is 0 if the call site was not captured. */
+	uint32 CallSiteId = 0;
+
+	/** Number of suspected objects. */
+	int32 ObjectsNum = 0;
+
+	/** How many seconds the oldest suspected object is taken. */
+	double OldestAgeSeconds = 0.0;
+};
+
+/**
+ * Is the place where objects were taken from, is captured only if leak detection is enabled.
+ * @see UPoolManagerSubsystem::CaptureCallSite
+ */
+struct POOLMANAGER_API FPoolCallSite
+{
+	/** Program counters of the native call stack. */
+	TArray<uint64> BackTrace;
+
+	/** Script call stack if objects were taken from Blueprints, since their native call stacks consist of the same VM frames. */
+	FString ScriptStack;
+
+	/** Readable description that is resolved on the first request, since symbolication is slow.
+	 * @see UPoolManagerSubsystem::DescribeCallSite */
+	mutable FString Description;
+
+	/** Returns memory in bytes allocated by this call site. */
+	FORCEINLINE SIZE_T GetAllocatedSize() const { return BackTrace.GetAllocatedSize() + ScriptStack.GetAllocatedSize() + Description.GetAllocatedSize(); }
+};
@@ -0,0 +1,42 @@
+// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Contains cumulative counters of the Pool Manager since its initialization or the last reset.
+ * Unlike stats, they are available in all builds, so tools and soak tests can compute rates between any two frames.
+ */
+struct POOLMANAGER_API FPoolManagerCounters
+{
+	/** Number of objects taken from free objects of the pool. */
+	int64 HitsNum = 0;
+
+	/** Number of take requests that found no free object, so new object was requested to be spawned. */
+	int64 MissesNum = 0;
+
+	/** Number of spawned objects that are registered in the pool. */
+	int64 SpawnsNum = 0;
+
+	/** Number of objects returned to the pool. */
+	int64 ReturnsNum = 0;
+
+	/** Returns the share of take requests served by free objects in range [0, 1], is 1 if nothing is taken. */
+	double GetHitRate() const
+	{
+		const int64 TakesNum = HitsNum + MissesNum;
+		return TakesNum > 0 ? static_cast<double>(HitsNum) / TakesNum : 1.0;
+	}
+
+	/** Returns the difference between these counters and older ones, e.g: to get counters of the last frame. */
+	FPoolManagerCounters operator-(const FPoolManagerCounters& Other) const
+	{
+		FPoolManagerCounters Result;
+		Result.HitsNum = HitsNum - Other.HitsNum;
+		Result.MissesNum = MissesNum - Other.MissesNum;
+		Result.SpawnsNum = SpawnsNum - Other.SpawnsNum;
+		Result.ReturnsNum = ReturnsNum - Other.ReturnsNum;
+		return Result;
+	}
+};
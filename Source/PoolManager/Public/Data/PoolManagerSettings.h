@@ -35,10 +35,54 @@ public:
 	UFUNCTION(BlueprintPure, Category = "[Pool Manager]")
 	int32 GetSpawnObjectsPerFrame() const { return SpawnObjectsPerFrame; }
 
+	/** Overrides the limit of how many actors to spawn per frame at runtime, e.g: by 'PoolManager.SetBudget' console command.
+	 * Is not saved to config. */
+	void SetSpawnObjectsPerFrame(int32 NewSpawnObjectsPerFrame) { SpawnObjectsPerFrame = FMath::Max(NewSpawnObjectsPerFrame, 1); }
+
 	/** Returns all Pool Factories that will be used by the Pool Manager. */
 	UFUNCTION(BlueprintPure, Category = "[Pool Manager]")
 	void GetPoolFactories(TArray<UClass*>& OutBlueprintPoolFactories) const;
 
+	/** Returns true if returned User Widgets are removed from their parent. */
+	UFUNCTION(BlueprintPure, Category = "[Pool Manager]")
+	bool ShouldDetachWidgetsOnReturn() const { return bDetachWidgetsOnReturn; }
+
+	/** Returns true if Slate resources of returned User Widgets are released. */
+	UFUNCTION(BlueprintPure, Category = "[Pool Manager]")
+	bool ShouldReleaseWidgetSlateResources() const { return bReleaseWidgetSlateResources; }
+
+	/** Returns true if properties of returned objects of given class have to be reset to their defaults. */
+	UFUNCTION(BlueprintPure, Category = "[Pool Manager]")
+	bool ShouldResetPropertiesOnReturn(const UClass* ObjectClass) const;
+
+	/** Returns true if free objects are demoted to the cold tier. */
+	UFUNCTION(BlueprintPure, Category = "[Pool Manager]")
+	bool IsColdTierEnabled() const { return ColdDemotionDelay > 0.f; }
+
+	/** Returns how many free objects per pool are kept hot, so they can be taken right away. */
+	UFUNCTION(BlueprintPure, Category = "[Pool Manager]")
+	int32 GetHotObjectsNum() const { return HotObjectsNum; }
+
+	/** Returns how many seconds free objects stay hot before they are demoted to the cold tier. */
+	UFUNCTION(BlueprintPure, Category = "[Pool Manager]")
+	float GetColdDemotionDelay() const { return ColdDemotionDelay; }
+
+	/** Returns true if the Pool Manager publishes thread-safe snapshots of all pools every frame. */
+	UFUNCTION(BlueprintPure, Category = "[Pool Manager]")
+	bool ShouldPublishSnapshots() const { return bPublishSnapshots; }
+
+	/** Returns true if taken objects are tracked to report those that are never returned to the pool. */
+	UFUNCTION(BlueprintPure, Category = "[Pool Manager]")
+	bool ShouldDetectLeaks() const { return bDetectLeaks; }
+
+	/** Returns how many seconds objects of given class can stay taken before they are reported as suspected leaks. */
+	UFUNCTION(BlueprintPure, Category = "[Pool Manager]")
+	float GetLeakThreshold(const UClass* ObjectClass) const;
+
+	/** Returns how often in seconds taken objects are scanned for leaks. */
+	UFUNCTION(BlueprintPure, Category = "[Pool Manager]")
+	float GetLeakScanInterval() const { return LeakScanInterval; }
+
 protected:
 	/** Set a limit of how many actors to spawn per frame. */
 	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "[Pool Manager]", meta = (BlueprintProtected = "true"))
@@ -47,4 +91,59 @@ protected:
 	/** All Pool Factories that will be used by the Pool Manager. */
 	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "[Pool Manager]", meta = (BlueprintProtected = "true"))
 	TArray<TSoftClassPtr<UPoolFactory_UObject>> PoolFactories;
+
+	/** If true, returned User Widgets are removed from their parent, so inactive widgets don't take part in layout, prepass and invalidation.
+	 * Taken widgets have to be added to a parent again, e.g: AddToViewport or AddChild. */
+	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "[Pool Manager]", meta = (BlueprintProtected = "true"))
+	bool bDetachWidgetsOnReturn = false;
+
+	/** If true, Slate widgets of returned User Widgets are released to save memory, while their Widget Tree is kept.
+	 * Slate widgets are rebuilt lazily once taken widget is added to a parent again, so taking becomes a bit slower.
+	 * Is applied only when 'Detach Widgets On Return' is enabled. */
+	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "[Pool Manager]", meta = (BlueprintProtected = "true", EditCondition = "bDetachWidgetsOnReturn"))
+	bool bReleaseWidgetSlateResources = false;
+
+	/** Classes (including their children) whose objects are reset to defaults on return to the pool,
+	 * so there is no need to reset each field manually in OnReturnToPool of the Pool Object Callback interface.
+	 * Only Blueprint properties that differ from the spawn template or class default object are copied back,
+	 * while properties of native classes (e.g: AActor, APawn or own C++ classes), subobjects and delegates are never reset,
+	 * so native state still has to be reset in OnReturnToPool. */
+	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "[Pool Manager]", meta = (BlueprintProtected = "true"))
+	TArray<TSoftClassPtr<UObject>> ResetPropertiesOnReturnClasses;
+
+	/** How many free objects per pool are kept hot: they are fully alive, so can be taken in microseconds.
+	 * The rest of free objects are demoted to the cold tier over time, and cold objects are promoted back ahead of demand. */
+	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "[Pool Manager]", meta = (BlueprintProtected = "true", ClampMin = "0"))
+	int32 HotObjectsNum = 4;
+
+	/** How many seconds free objects stay hot above 'Hot Objects Num' before they are demoted to the cold tier.
+	 * Cold objects release their heavy resources (e.g: unregister components or release Slate widgets), they use less memory, but take longer to be taken.
+	 * Set to 0 to disable the cold tier. */
+	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "[Pool Manager]", meta = (BlueprintProtected = "true", ClampMin = "0", Units = "s"))
+	float ColdDemotionDelay = 0.f;
+
+	/** If true, the Pool Manager publishes a read-only snapshot of all pools at the end of each frame,
+	 * so its thread-safe getters (e.g: GetFreeObjectsNumThreadSafe) can be called from any thread without locks:
+	 * the snapshot is published by atomic pointer swap and replaced snapshots are released later, once no reader can access them.
+	 * Keep disabled if not needed, since it copies states of all pooled objects every frame. */
+	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "[Pool Manager]", meta = (BlueprintProtected = "true"))
+	bool bPublishSnapshots = false;
+
+	/** If true, the call site of each take is captured and taken objects are periodically scanned,
+	 * so objects that are never returned to the pool are reported in the log grouped by class and call site.
+	 * Is intended for development, since capturing the call stack makes each take slower. */
+	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "[Pool Manager]", meta = (BlueprintProtected = "true"))
+	bool bDetectLeaks = false;
+
+	/** How many seconds objects can stay taken before they are reported as suspected leaks, unless overridden per class. */
+	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "[Pool Manager]", meta = (BlueprintProtected = "true", EditCondition = "bDetectLeaks", ClampMin = "0", Units = "s"))
+	float DefaultLeakThreshold = 60.f;
+
+	/** Overrides 'Default Leak Threshold' for given classes (including their children), e.g: long-living characters. */
+	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "[Pool Manager]", meta = (BlueprintProtected = "true", EditCondition = "bDetectLeaks", Units = "s"))
+	TMap<TSoftClassPtr<UObject>, float> LeakThresholds;
+
+	/** How often in seconds taken objects are scanned for leaks. */
+	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "[Pool Manager]", meta = (BlueprintProtected = "true", EditCondition = "bDetectLeaks", ClampMin = "0.1", Units = "s"))
+	float LeakScanInterval = 10.f;
 };
@@ -47,10 +47,33 @@ struct POOLMANAGER_API FPoolObjectData
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Transient)
 	TObjectPtr<UObject> PoolObject = nullptr;
 
+	/** Is true if the object is free and demoted to the cold tier, so its heavy resources are released.
+	 * @see UPoolManagerSettings::ColdDemotionDelay */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Transient)
+	bool bIsCold = false;
+
+	/** The variant key the object was last taken with, is None if the object has no variants.
+	 * @see FSpawnRequest::VariantKey */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Transient)
+	FName VariantKey = NAME_None;
+
+	/** Id of the call site where this object was taken last time, is 0 if leak detection is disabled.
+	 * @see UPoolManagerSubsystem::DescribeCallSite */
+	uint32 TakenCallSiteId = 0;
+
+	/** Platform time in seconds when the state of this object was changed last time.
+	 * While the object is active, it is the time when it was taken. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Transient)
+	double LastStateChangeTime = 0.0;
+
 	/** The handle associated with this pool object for management within the Pool Manager system. */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Transient)
 	FPoolObjectHandle Handle = FPoolObjectHandle::EmptyHandle;
 
+	/** The handle that was reserved by the caller before this free object was taken, e.g: by UPoolManagerSubsystem::EnqueueTakeFromPool.
+	 * Is the alias of the own handle that is never changed, so both of them find this object until it is returned to the pool. */
+	FPoolObjectHandle ReservedHandle = FPoolObjectHandle::EmptyHandle;
+
 	/*********************************************************************************************
 	 * Getters and operators
 	 ********************************************************************************************* */
@@ -64,6 +87,9 @@ struct POOLMANAGER_API FPoolObjectData
 	/** Returns true if handled object is inactive and ready to be taken from pool. */
 	FORCEINLINE bool IsFree() const { return !bIsActive && IsValid(); }
 
+	/** Returns true if handled object is free and can be taken from pool right away, without restoring its resources. */
+	FORCEINLINE bool IsHot() const { return IsFree() && !bIsCold; }
+
 	/** Returns true if the object is created. */
 	FORCEINLINE bool IsValid() const { return PoolObject && Handle.IsValid(); }
 
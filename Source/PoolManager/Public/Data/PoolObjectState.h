@@ -15,5 +15,7 @@ enum class EPoolObjectState : uint8
 	///< Contains in pool, is free and ready to be taken
 	Inactive,
 	///< Was taken from pool and can be returned back.
-	Active
+	Active,
+	///< Contains in pool and is free, but its heavy resources are released (e.g: components are unregistered), so it takes longer to be taken
+	Cold
 };
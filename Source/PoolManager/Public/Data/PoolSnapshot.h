@@ -0,0 +1,58 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "UObject/Object.h"
+#include "Templates/SharedPointer.h"
+
+enum class EPoolObjectState : uint8;
+
+/**
+ * Contains counters of one pool at the moment of taking the snapshot.
+ */
+struct POOLMANAGER_API FPoolClassSnapshot
+{
+	/** Number of objects that are inactive and ready to be taken from the pool. */
+	int32 FreeObjectsNum = 0;
+
+	/** Number of free objects that are demoted to the cold tier, is included in FreeObjectsNum. */
+	int32 ColdObjectsNum = 0;
+
+	/** Number of objects that are currently taken from the pool. */
+	int32 ActiveObjectsNum = 0;
+
+	/** Number of all objects that are handled by the pool. */
+	int32 RegisteredObjectsNum = 0;
+
+	/** Number of objects that are requested to be spawned, but are not spawned yet. */
+	int32 SpawnQueueNum = 0;
+};
+
+/**
+ * Is read-only copy of all pools that is published by the Pool Manager once per frame on the game thread.
+ * Is immutable once published and is shared by reference, so any thread can keep reading it while newer snapshots are published.
+ * Readers take the reference from the snapshot itself, since only its raw pointer is published atomically.
+ * Pointers are used only as keys and are never dereferenced, so it is safe to query destroyed objects.
+ */
+struct POOLMANAGER_API FPoolSnapshot : public TSharedFromThis<FPoolSnapshot, ESPMode::ThreadSafe>
+{
+	/** The frame number when this snapshot was taken. */
+	uint64 FrameNumber = 0;
+
+	/** Counters of each pool by its class. */
+	TMap<const UClass*, FPoolClassSnapshot> Pools;
+
+	/** States of all registered objects. */
+	TMap<const UObject*, EPoolObjectState> ObjectStates;
+
+	/** Clears the data, but keeps the allocated memory to be reused by next snapshot. */
+	void Reset()
+	{
+		FrameNumber = 0;
+		Pools.Reset();
+		ObjectStates.Reset();
+	}
+};
+
+/** Shared reference to the published snapshot, readers keep it alive for as long as they need it. */
+using FPoolSnapshotPtr = TSharedPtr<const FPoolSnapshot, ESPMode::ThreadSafe>;
@@ -0,0 +1,22 @@
+// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+// Pool Manager
+#include "Data/PoolObjectHandle.h"
+
+struct FStreamableHandle;
+
+/**
+ * Is the take of soft class that is requested by UPoolManagerSubsystem::TakeFromPoolSoft().
+ * Is kept by the handle reserved for the caller until the taken object is returned,
+ * since the reserved handle can't refer to the class that is not loaded yet.
+ */
+struct POOLMANAGER_API FPoolSoftTake
+{
+	/** Handle of async loading of the class, is reset once the class is loaded. */
+	TSharedPtr<FStreamableHandle> StreamableHandle = nullptr;
+
+	/** Own handle of the taken object or its spawn request, is empty while the class is loading. */
+	FPoolObjectHandle ObjectHandle = FPoolObjectHandle::EmptyHandle;
+};
@@ -0,0 +1,73 @@
+// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+/**
+ * Describes single spawn that took longer than 'Spawn Hitch Threshold' of its factory.
+ * @see UPoolFactory_UObject::GetRecentSpawnHitches
+ */
+struct POOLMANAGER_API FPoolSpawnHitch
+{
+	/** Class of the spawned object. */
+	TWeakObjectPtr<const UClass> ObjectClass = nullptr;
+
+	/** How long the spawn took in milliseconds. */
+	double DurationMs = 0.0;
+
+	/** The frame number when the object was spawned. */
+	uint64 FrameNumber = 0;
+};
+
+/**
+ * Histogram of latencies between requesting the spawn and receiving the spawned object, both in frames and in milliseconds.
+ * Frames are counted exactly up to 'FramesBucketsNum - 1', while milliseconds are grouped by powers of two.
+ * @see UPoolFactory_UObject::GetSpawnLatency
+ */
+struct POOLMANAGER_API FPoolSpawnLatencyHistogram
+{
+	/** Number of buckets for latencies in frames, the last one contains all longer latencies. */
+	static constexpr int32 FramesBucketsNum = 17;
+
+	/** Number of buckets for latencies in milliseconds: [0, 1), [1, 2), [2, 4) ... the last one contains all longer latencies. */
+	static constexpr int32 MsBucketsNum = 12;
+
+	/** Number of spawned objects per latency in frames. */
+	TStaticArray<int32, FramesBucketsNum> FramesBuckets{InPlace, 0};
+
+	/** Number of spawned objects per latency in milliseconds. */
+	TStaticArray<int32, MsBucketsNum> MsBuckets{InPlace, 0};
+
+	/** Number of all recorded spawns. */
+	int32 SamplesNum = 0;
+
+	/** Sum of all recorded latencies in milliseconds, is used to get the average. */
+	double TotalMs = 0.0;
+
+	/** The longest recorded latency in milliseconds. */
+	double MaxMs = 0.0;
+
+	/** The longest recorded latency in frames. */
+	int32 MaxFrames = 0;
+
+	/** Records the latency of one spawn. */
+	void Add(int32 LatencyFrames, double LatencyMs);
+
+	/** Merges given histogram into this one, e.g: to get latencies of all classes. */
+	void Append(const FPoolSpawnLatencyHistogram& Other);
+
+	/** Returns the latency in frames that is not exceeded by given percent of spawns, e.g: 99 for the 99th percentile. */
+	int32 GetPercentileFrames(float Percentile) const;
+
+	/** Returns the upper bound of the latency in milliseconds that is not exceeded by given percent of spawns. */
+	double GetPercentileMs(float Percentile) const;
+
+	/** Returns the average latency in milliseconds. */
+	double GetAverageMs() const { return SamplesNum > 0 ? TotalMs / SamplesNum : 0.0; }
+
+	/** Returns the upper bound in milliseconds of given bucket, the last bucket is bounded by the longest latency. */
+	double GetMsBucketUpperBound(int32 BucketIndex) const;
+};
@@ -42,6 +42,22 @@ struct POOLMANAGER_API FSpawnRequest
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Transient)
 	ESpawnRequestPriority Priority = ESpawnRequestPriority::Normal;
 
+	/** Optional key of the look or configuration of the object, e.g: the material of a decal.
+	 * Free objects that were last used with the same key are taken first, so they don't need to be reconfigured. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Transient)
+	FName VariantKey = NAME_None;
+
+	/** Id of the call site that requested the object, is captured only if leak detection is enabled.
+	 * @see FPoolObjectData::TakenCallSiteId */
+	uint32 CallSiteId = 0;
+
+	/** Platform time in seconds when the spawn was requested, is used to measure the spawn latency.
+	 * Is set by the Pool Manager, the latency is not measured if it is 0. */
+	double RequestTime = 0.0;
+
+	/** The frame number when the spawn was requested, is used to measure the spawn latency in frames. */
+	uint64 RequestFrame = 0;
+
 	/** The handle associated with spawning pool object for management within the Pool Manager system.
 	 * Is generated automatically if not set. */
 	UPROPERTY(BlueprintReadOnly, Transient)
@@ -21,4 +21,12 @@ struct FTakeFromPoolPayload
 	/** Is true whenever the object is newly spawned instead of taken from existing pool. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Transient)
 	bool bIsNewSpawned = false;
+
+	/** The variant key the object is taken with, e.g: the material of a decal, is None if not specified. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Transient)
+	FName VariantKey = NAME_None;
+
+	/** Is false if the object was last used with the same variant key, so its look or configuration can be kept as is. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Transient)
+	bool bNeedsReconfiguration = true;
 };
@@ -4,6 +4,7 @@
 
 // Pool Manager
 #include "PoolFactory_UObject.h"
+#include "Data/PoolDeferredActorSpawn.h"
 
 #include "PoolFactory_Actor.generated.h"
 
@@ -12,6 +13,9 @@
  * Creation: call SpawnActor.  
  * Destruction: call DestroyActor.
  * Pool: change visibility, collision, ticking, etc.
+ * Actors that implement IPoolObjectBatchTick never have their own tick enabled, they are ticked by the Pool Manager instead.
+ * Cold actors have their components unregistered to release render and physics state.
+ * If 'Split Spawn Across Frames' is enabled, non-critical actors are spawned across multiple frames: SpawnActor (deferred) -> FinishSpawning -> Register in the pool.
  */
 UCLASS()
 class POOLMANAGER_API UPoolFactory_Actor : public UPoolFactory_UObject
@@ -36,9 +40,34 @@ public:
 	/** Is overridden to spawn actors using its engine's Spawn Actor method. */
 	virtual UObject* SpawnNow_Implementation(const FSpawnRequest& Request) override;
 
-	/** Is overridden to finish spawning the actor since it was deferred. */
+	/** Is overridden to always spawn actors on the game thread since they interact with the world. */
+	virtual bool CanSpawnOnWorkerThread(const FSpawnRequest& Request) const override { return false; }
+
+	/** Is overridden to finish spawning the actor since it was deferred, if it was not finished on previous stage. */
 	virtual void OnPreRegistered(const FSpawnRequest& Request, const FPoolObjectData& ObjectData) override;
 
+	/** Is overridden to cancel actors that are spawned across multiple frames. */
+	virtual bool DequeueSpawnRequestByHandle(const struct FPoolObjectHandle& Handle, FSpawnRequest& OutRequest) override;
+
+	/** Is overridden to take into account actors that are spawned across multiple frames. */
+	virtual bool IsSpawnQueueEmpty() const override { return Super::IsSpawnQueueEmpty() && DeferredSpawns.IsEmpty(); }
+
+	/** Is overridden to take into account actors that are spawned across multiple frames. */
+	virtual int32 GetSpawnQueueNum(const UClass* ObjectClass = nullptr) const override;
+
+	/** Is overridden to take into account actors that are spawned across multiple frames. */
+	virtual int32 GetSpawnQueueNumByPriority(ESpawnRequestPriority Priority) const override;
+
+protected:
+	/** Is overridden to continue spawning of non-critical actors on next frames instead of registering them right away. */
+	virtual void ProcessSpawnedObject(const FSpawnRequest& Request, UObject& CreatedObject) override;
+
+	/** Is overridden to finish construction or register actors that are spawned across multiple frames, one stage per actor per frame. */
+	virtual int32 ProcessDeferredSpawnStages(int32 Budget) override;
+
+	/** Is overridden to return true if there are actors that are spawned across multiple frames. */
+	virtual bool HasDeferredSpawnStages() const override { return !DeferredSpawns.IsEmpty(); }
+
 	/*********************************************************************************************
 	 * Destruction
 	 ********************************************************************************************* */
@@ -58,4 +87,19 @@ public:
 
 	/** Is overridden to change visibility, collision, ticking, etc. according new state. */
 	virtual void OnChangedStateInPool_Implementation(EPoolObjectState NewState, UObject* InObject) override;
+
+	/*********************************************************************************************
+	 * Data
+	 ********************************************************************************************* */
+protected:
+	/** Actors that are spawned, but waiting for their next stage to be registered in the pool. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Transient, AdvancedDisplay, Category = "[Pool Manager]", meta = (BlueprintProtected))
+	TArray<FPoolDeferredActorSpawn> DeferredSpawns;
+
+	/** If true, SpawnActor, FinishSpawning (construction script and BeginPlay) and registration in the pool are performed on different frames,
+	 * so a single heavy Blueprint actor does not cause a spike, SpawnActor and FinishSpawning are charged separately against 'SpawnObjectsPerFrame'.
+	 * Spawned actors are registered in the pool two frames later, so enable it only for factories of heavy actors.
+	 * Critical requests are always spawned at once. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "[Pool Manager]", meta = (BlueprintProtected))
+	bool bSplitSpawnAcrossFrames = false;
 };
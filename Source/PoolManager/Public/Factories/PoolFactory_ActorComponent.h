@@ -0,0 +1,75 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+// Pool Manager
+#include "PoolFactory_UObject.h"
+
+#include "PoolFactory_ActorComponent.generated.h"
+
+/**
+ * Is responsible for managing actor components, it handles such differences in components as:
+ * Creation: call NewObject+RegisterComponent in the host actor.
+ * Destruction: call DestroyComponent.
+ * Pool: change activation and ticking.
+ * Components are never unregistered while in pool, so their render and physics states stay stable.
+ */
+UCLASS()
+class POOLMANAGER_API UPoolFactory_ActorComponent : public UPoolFactory_UObject
+{
+	GENERATED_BODY()
+
+	/*********************************************************************************************
+	 * Setup overrides
+	 ********************************************************************************************* */
+public:
+	/** Is overridden to handle ActorComponent-inherited classes. */
+	virtual const UClass* GetObjectClass_Implementation() const override;
+
+	/*********************************************************************************************
+	 * Creation
+	 ********************************************************************************************* */
+public:
+	/** Is overridden to create the component in the host actor and register it. */
+	virtual UObject* SpawnNow_Implementation(const FSpawnRequest& Request) override;
+
+	/** Is overridden to always spawn components on the game thread since they interact with the world. */
+	virtual bool CanSpawnOnWorkerThread(const FSpawnRequest& Request) const override { return false; }
+
+	/*********************************************************************************************
+	 * Destruction
+	 ********************************************************************************************* */
+public:
+	/** Is overridden to destroy given component using its engine's Destroy Component method. */
+	virtual void Destroy_Implementation(UObject* Object) override;
+
+	/*********************************************************************************************
+	 * Pool
+	 ********************************************************************************************* */
+public:
+	/** Is overridden to change activation and ticking according new state. */
+	virtual void OnChangedStateInPool_Implementation(EPoolObjectState NewState, UObject* InObject) override;
+
+	/*********************************************************************************************
+	 * Host Actor
+	 ********************************************************************************************* */
+public:
+	/** Returns the actor that owns all pooled components of this factory, is spawned on first request. */
+	UFUNCTION(BlueprintCallable, Category = "[Pool Manager]")
+	AActor* GetHostActor();
+	AActor& GetHostActorChecked();
+
+	/** Spawns transient actor with the scene root in the Persistent level, is used to own pooled components and instances. */
+	static AActor* SpawnTransientHostActor(UWorld& World, FName BaseName);
+
+protected:
+	/** Is the actor that owns all pooled components of this factory.
+	 * Taken components can be attached anywhere, they are attached back to this actor once returned to the pool. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Transient, AdvancedDisplay, Category = "[Pool Manager]", meta = (BlueprintProtected))
+	TObjectPtr<AActor> HostActor = nullptr;
+
+	/** Spawns new host actor for pooled components. */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "[Pool Manager]", meta = (BlueprintProtected))
+	AActor* SpawnHostActor();
+	virtual AActor* SpawnHostActor_Implementation();
+};
@@ -0,0 +1,82 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+// Pool Manager
+#include "Factories/PoolFactory_Actor.h"
+
+#include "PoolFactory_InstancedMesh.generated.h"
+
+class UInstancedStaticMeshComponent;
+class UPoolInstancedMeshProxy;
+
+/**
+ * Is responsible for managing Instanced Mesh Proxies, it handles such differences in proxies as:
+ * Creation: add an instance to the shared Instanced Static Mesh component of the proxy class, or reuse recycled instance.
+ * Destruction: hide the instance and recycle its slot to be reused by next spawned proxy.
+ * Pool: instance is hidden when is returned and moved to the requested transform when is taken.
+ * Instances are never removed from the component to keep indices of all other instances stable.
+ * @see UPoolInstancedMeshProxy
+ */
+UCLASS()
+class POOLMANAGER_API UPoolFactory_InstancedMesh : public UPoolFactory_UObject
+{
+	GENERATED_BODY()
+
+	/*********************************************************************************************
+	 * Setup overrides
+	 ********************************************************************************************* */
+public:
+	/** Is overridden to handle Instanced Mesh Proxy-inherited classes. */
+	virtual const UClass* GetObjectClass_Implementation() const override;
+
+	/*********************************************************************************************
+	 * Creation
+	 ********************************************************************************************* */
+public:
+	/** Is overridden to create the proxy and add or reuse its instance in the shared component. */
+	virtual UObject* SpawnNow_Implementation(const FSpawnRequest& Request) override;
+
+	/** Is overridden to always spawn instances on the game thread since they interact with the world. */
+	virtual bool CanSpawnOnWorkerThread(const FSpawnRequest& Request) const override { return false; }
+
+	/*********************************************************************************************
+	 * Destruction
+	 ********************************************************************************************* */
+public:
+	/** Is overridden to hide the instance and recycle its slot instead of removing it. */
+	virtual void Destroy_Implementation(UObject* Object) override;
+
+	/*********************************************************************************************
+	 * Pool
+	 ********************************************************************************************* */
+public:
+	/** Is overridden to move the instance to the requested transform before taking the object from its pool. */
+	virtual void OnTakeFromPool_Implementation(UObject* Object, const FTakeFromPoolPayload& Payload) override;
+
+	/** Is overridden to hide the instance when it is returned to the pool. */
+	virtual void OnChangedStateInPool_Implementation(EPoolObjectState NewState, UObject* InObject) override;
+
+	/*********************************************************************************************
+	 * Instanced Meshes
+	 ********************************************************************************************* */
+public:
+	/** Returns the shared component that renders all instances of given proxy class, creates it on first request. */
+	UFUNCTION(BlueprintCallable, Category = "[Pool Manager]")
+	UInstancedStaticMeshComponent* FindOrAddInstancedMesh(TSubclassOf<UPoolInstancedMeshProxy> ProxyClass);
+
+	/** Returns transform to hide the instance: far away and with zero scale, so it is culled. */
+	static FTransform GetHiddenInstanceTransform() { return FTransform(FQuat::Identity, UPoolFactory_Actor::MaxPos, FVector(0.f)); }
+
+protected:
+	/** Is the actor that owns all shared Instanced Static Mesh components of this factory. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Transient, AdvancedDisplay, Category = "[Pool Manager]", meta = (BlueprintProtected))
+	TObjectPtr<AActor> HostActor = nullptr;
+
+	/** Shared Instanced Static Mesh components by their proxy classes. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Transient, AdvancedDisplay, Category = "[Pool Manager]", meta = (BlueprintProtected))
+	TMap<TObjectPtr<const UClass>, TObjectPtr<UInstancedStaticMeshComponent>> InstancedMeshes;
+
+	/** Indices of hidden instances of destroyed proxies by their proxy classes, are reused by next spawned proxies. */
+	TMap<TObjectPtr<const UClass>, TArray<int32>> RecycledInstances;
+};
@@ -0,0 +1,47 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+// Pool Manager
+#include "PoolFactory_ActorComponent.h"
+
+#include "PoolFactory_SceneComponent.generated.h"
+
+/**
+ * Is responsible for managing scene components, such as decals, spline meshes, audio etc. without spawning whole actor for each.
+ * In addition to the Actor Component factory, it handles:
+ * Creation: attach to the host actor at requested transform.
+ * Pool: set transform on taking, attach back to the host actor on returning, change visibility.
+ */
+UCLASS()
+class POOLMANAGER_API UPoolFactory_SceneComponent : public UPoolFactory_ActorComponent
+{
+	GENERATED_BODY()
+
+	/*********************************************************************************************
+	 * Setup overrides
+	 ********************************************************************************************* */
+public:
+	/** Is overridden to handle SceneComponent-inherited classes. */
+	virtual const UClass* GetObjectClass_Implementation() const override;
+
+	/*********************************************************************************************
+	 * Creation
+	 ********************************************************************************************* */
+public:
+	/** Is overridden to attach the component to the host actor before its registration. */
+	virtual UObject* SpawnNow_Implementation(const FSpawnRequest& Request) override;
+
+	/*********************************************************************************************
+	 * Pool
+	 ********************************************************************************************* */
+public:
+	/** Is overridden to set transform to the component before taking the object from its pool. */
+	virtual void OnTakeFromPool_Implementation(UObject* Object, const FTakeFromPoolPayload& Payload) override;
+
+	/** Is overridden to attach the component back to the host actor before returning the object to its pool. */
+	virtual void OnReturnToPool_Implementation(UObject* Object) override;
+
+	/** Is overridden to change visibility according new state. */
+	virtual void OnChangedStateInPool_Implementation(EPoolObjectState NewState, UObject* InObject) override;
+};
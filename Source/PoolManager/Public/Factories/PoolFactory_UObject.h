@@ -5,6 +5,7 @@
 #include "UObject/Object.h"
 
 // Pool Manager
+#include "Data/PoolSpawnLatency.h"
 #include "Data/SpawnRequest.h"
 
 #include "PoolFactory_UObject.generated.h"
@@ -68,9 +69,21 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "[Pool Manager]")
 	virtual bool DequeueSpawnRequestByHandle(const struct FPoolObjectHandle& Handle, FSpawnRequest& OutRequest);
 
+	/** Processes the chunk of the spawn queue that is scheduled for next tick right away, does nothing if nothing is scheduled.
+	 * Is useful when the world is ticked manually many times within one engine frame (e.g: in tests), since its timers are ticked only once per frame. */
+	void ProcessScheduledSpawnNow();
+
 	/** Returns true if the spawn queue is empty, so there are no spawn request at current moment. */
 	UFUNCTION(BlueprintPure, Category = "[Pool Manager]")
-	virtual FORCEINLINE bool IsSpawnQueueEmpty() const { return SpawnQueue.IsEmpty(); }
+	virtual FORCEINLINE bool IsSpawnQueueEmpty() const { return SpawnQueue.IsEmpty() && WorkerThreadRequests.IsEmpty(); }
+
+	/** Returns number of requests that are waiting to be spawned by given class or of all classes if class is not specified. */
+	UFUNCTION(BlueprintPure, Category = "[Pool Manager]")
+	virtual int32 GetSpawnQueueNum(const UClass* ObjectClass = nullptr) const;
+
+	/** Returns number of requests of all classes that are waiting to be spawned with given priority. */
+	UFUNCTION(BlueprintPure, Category = "[Pool Manager]")
+	virtual int32 GetSpawnQueueNumByPriority(ESpawnRequestPriority Priority) const;
 
 	/** Is called right after object is spawned and before it is registered in the Pool.
 	 * Is called after 'SpawnNow'. */
@@ -83,11 +96,71 @@ public:
 	virtual void OnPostSpawned(const FSpawnRequest& Request, const struct FPoolObjectData& ObjectData);
 
 protected:
+	/** Registers just spawned object in the pool and notifies all listeners.
+	 * Is called after the object is spawned on the game thread or constructed on worker thread. */
+	virtual void ProcessSpawnedObject(const FSpawnRequest& Request, UObject& CreatedObject);
+
 	/** Is called on next frame to process a chunk of the spawn queue. */
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "[Pool Manager]", meta = (BlueprintProtected))
 	void OnNextTickProcessSpawn();
 	virtual void OnNextTickProcessSpawn_Implementation();
 
+	/** Schedules OnNextTickProcessSpawn() to be called on next frame if it is not scheduled yet. */
+	void ScheduleNextTickProcessSpawn();
+
+	/** Processes next stages of objects that are spawned across multiple frames.
+	 * Is called on next frame before spawning new objects, override by child factories that split spawning into stages.
+	 * @param Budget How many stages can be processed this frame, is shared with 'SpawnObjectsPerFrame'.
+	 * @return Number of processed stages that are charged against the budget. */
+	virtual int32 ProcessDeferredSpawnStages(int32 Budget) { return 0; }
+
+	/** Returns true if there are spawned objects that are waiting for their next stage. */
+	virtual bool HasDeferredSpawnStages() const { return false; }
+
+	/*********************************************************************************************
+	 * Templates
+	 * New objects can be created as copies of configured template instead of the class default object.
+	 ********************************************************************************************* */
+public:
+	/** Sets the instance that new objects of given class are copied from, so growing the pool copies initialized state instead of recomputing it.
+	 * Is passed as the Template to NewObject or to FActorSpawnParameters for actors, unique names are not generated for such objects.
+	 * The template has to be exactly of given class, should not be used in gameplay and is kept alive by this factory.
+	 * @param ObjectClass The class of objects to create from the template.
+	 * @param Template The instance to copy or null to create new objects from the class default object again. */
+	UFUNCTION(BlueprintCallable, Category = "[Pool Manager]")
+	virtual void SetSpawnTemplate(const UClass* ObjectClass, UObject* Template);
+
+	/** Returns the template of given class or null if new objects are created from the class default object. */
+	UFUNCTION(BlueprintPure, Category = "[Pool Manager]")
+	UObject* FindSpawnTemplate(const UClass* ObjectClass) const;
+
+protected:
+	/** Returns the name for new object created from the template.
+	 * Is cheaper than MakeUniqueObjectName since it uses cached class name with monotonic counter, so the name is never looked up in the outer. */
+	FName MakeSpawnName(const UClass* ObjectClass);
+
+	/*********************************************************************************************
+	 * Worker Threads Creation
+	 * RequestSpawn -> SpawnOnWorkerThreads -> ConstructOnWorkerThread -> OnConstructedOnWorkerThreads -> OnPreRegistered -> OnPostSpawned
+	 ********************************************************************************************* */
+public:
+	/** Returns true if given request can be constructed on worker threads instead of the game thread.
+	 * Such requests don't consume 'SpawnObjectsPerFrame', they are constructed all at once in background
+	 * and only registered on the game thread, so it is perfect for prewarming large pools of data objects.
+	 * Override by child factories that interact with the world (actors, components, widgets) to always return false. */
+	virtual bool CanSpawnOnWorkerThread(const FSpawnRequest& Request) const;
+
+protected:
+	/** Launches background task that constructs objects of given requests, is called on the game thread. */
+	virtual void SpawnOnWorkerThreads(TArray<FSpawnRequest>&& Requests);
+
+	/** Constructs the object on worker thread, is called under GC guard, so it has to be pure CPU work with no world interaction.
+	 * Is used instead of SpawnNow() for requests that can be spawned on worker threads. */
+	virtual UObject* ConstructOnWorkerThread(UObject* Outer, UClass* ObjectClass) const;
+
+	/** Registers objects constructed on worker threads, is called on the game thread. */
+	virtual void OnConstructedOnWorkerThreads(const TArray<TPair<struct FPoolObjectHandle, UObject*>>& ConstructedObjects);
+
 	/*********************************************************************************************
 	 * Destruction
 	 ********************************************************************************************* */
@@ -116,6 +189,61 @@ public:
 	void OnChangedStateInPool(EPoolObjectState NewState, UObject* InObject);
 	virtual void OnChangedStateInPool_Implementation(EPoolObjectState NewState, UObject* InObject);
 
+	/*********************************************************************************************
+	 * Property Reset
+	 * Is enabled by 'Reset Properties On Return Classes' in 'Project Settings' -> "Plugins" -> "Pool Manager".
+	 ********************************************************************************************* */
+public:
+	/** Resets properties of given object that differ from its spawn template or class default object.
+	 * Is called on return to the pool after the object is notified, so it can still read its state in OnReturnToPool. */
+	virtual void ResetPropertiesToDefaults(UObject& Object);
+
+protected:
+	/** Returns cached list of properties that are reset on return for given class, is empty if the class is not opted-in.
+	 * Only properties declared in Blueprint classes are included, since the state of native classes
+	 * (e.g: APawn::Controller) is kept consistent with the engine by themselves and by the factory. */
+	const TArray<const FProperty*>& GetResetPropertiesLayout(const UClass* ObjectClass);
+
+	/** Cached lists of properties that are reset on return by their class.
+	 * @see UPoolFactory_UObject::GetResetPropertiesLayout */
+	TMap<TObjectKey<UClass>, TArray<const FProperty*>> ResetPropertiesLayouts;
+
+	/*********************************************************************************************
+	 * Spawn Latency
+	 * Measures the time between requesting the spawn and notifying about the spawned object.
+	 ********************************************************************************************* */
+public:
+	/** Returns the histogram of spawn latencies by given class and priority.
+	 * @param ObjectClass If null, latencies of all classes are merged.
+	 * @param Priority If None, latencies of all priorities are merged. */
+	FPoolSpawnLatencyHistogram GetSpawnLatency(const UClass* ObjectClass = nullptr, ESpawnRequestPriority Priority = ESpawnRequestPriority::None) const;
+
+	/** Clears all recorded spawn latencies, e.g: to measure only the next gameplay section. */
+	void ResetSpawnLatencies() { SpawnLatencies.Reset(); }
+
+	/** Returns the last spawns that took longer than 'Spawn Hitch Threshold Ms', is not sorted. */
+	const FORCEINLINE TArray<FPoolSpawnHitch>& GetRecentSpawnHitches() const { return RecentSpawnHitches; }
+
+protected:
+	/** Records the latency of given request that is spawned right now. */
+	virtual void RecordSpawnLatency(const FSpawnRequest& Request);
+
+	/** Records the spawn of given class if it took longer than 'Spawn Hitch Threshold Ms'. */
+	void RecordSpawnHitch(const UClass* ObjectClass, double DurationMs);
+
+	/** Histograms of spawn latencies by class and priority. */
+	TMap<TPair<TObjectKey<UClass>, ESpawnRequestPriority>, FPoolSpawnLatencyHistogram> SpawnLatencies;
+
+	/** Ring of the last spawns that took longer than 'Spawn Hitch Threshold Ms'. */
+	TArray<FPoolSpawnHitch> RecentSpawnHitches;
+
+	/** Index in RecentSpawnHitches where the next hitch is written once the ring is full. */
+	int32 NextSpawnHitchIndex = 0;
+
+	/** Spawns on the game thread that take longer than this are recorded as hitches, e.g: for the Gameplay Debugger. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "[Pool Manager]", meta = (BlueprintProtected, ClampMin = "0", Units = "ms"))
+	float SpawnHitchThresholdMs = 2.f;
+
 	/*********************************************************************************************
 	 * Data
 	 ********************************************************************************************* */
@@ -123,4 +251,30 @@ protected:
 	/** All request to spawn. */
 	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Transient, AdvancedDisplay, Category = "[Pool Manager]", meta = (BlueprintProtected))
 	TArray<FSpawnRequest> SpawnQueue;
+
+	/** Requests that are currently constructed on worker threads by their handles, they are waiting to be registered on the game thread.
+	 * Is keyed by handle, so each constructed object finds its request in constant time even for large prewarms. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Transient, AdvancedDisplay, Category = "[Pool Manager]", meta = (BlueprintProtected))
+	TMap<FPoolObjectHandle, FSpawnRequest> WorkerThreadRequests;
+
+	/** If true, objects of this factory are constructed on worker threads, is ignored for Critical requests.
+	 * Enable only if constructors of all pooled classes are thread-safe and don't interact with the world.
+	 * Blueprint overrides of SpawnNow are not called for such objects, override ConstructOnWorkerThread in code instead. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "[Pool Manager]", meta = (BlueprintProtected))
+	bool bSpawnOnWorkerThreads = false;
+
+	/** Instances that new objects are copied from by their class.
+	 * @see UPoolFactory_UObject::SetSpawnTemplate */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Transient, AdvancedDisplay, Category = "[Pool Manager]", meta = (BlueprintProtected))
+	TMap<TObjectPtr<const UClass>, TObjectPtr<UObject>> SpawnTemplates;
+
+	/** Cached base names of objects created from templates by their class. */
+	TMap<TObjectKey<UClass>, FName> SpawnBaseNames;
+
+	/** Is incremented for each object created from a template to give it a new name.
+	 * Is shared by all factories, so objects of the same class never get the same name even if the factory is recreated. */
+	inline static int32 SpawnNameCounter = 0;
+
+	/** Is true if OnNextTickProcessSpawn() is already scheduled for next frame. */
+	bool bIsNextTickProcessSpawnScheduled = false;
 };
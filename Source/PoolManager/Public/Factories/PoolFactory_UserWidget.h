@@ -9,6 +9,8 @@
 
 /**
  * Is responsible for managing User Widgets, it properly creates and destroys them.
+ * Optionally, returned widgets are detached from their parent and their Slate resources are released,
+ * it is set up in 'Project Settings' -> "Plugins" -> "Pool Manager".
  */
 UCLASS()
 class POOLMANAGER_API UPoolFactory_UserWidget : public UPoolFactory_UObject
@@ -26,9 +28,13 @@ public:
 	 * Creation
 	 ********************************************************************************************* */
 public:
-	/** Is overridden to create the User Widget using its engine's 'Create Widget' method. */
+	/** Is overridden to create the User Widget using its engine's 'Create Widget' method.
+	 * Spawn templates are ignored since 'Create Widget' always initializes the widget tree from its class. */
 	virtual UObject* SpawnNow_Implementation(const FSpawnRequest& Request) override;
 
+	/** Is overridden to always spawn widgets on the game thread since they interact with the world. */
+	virtual bool CanSpawnOnWorkerThread(const FSpawnRequest& Request) const override { return false; }
+
 	/*********************************************************************************************
 	 * Destruction
 	 ********************************************************************************************* */
@@ -40,6 +46,9 @@ public:
 	 * Pool
 	 ********************************************************************************************* */
 public:
+	/** Is overridden to detach the widget from its parent and release its Slate resources if enabled in settings. */
+	virtual void OnReturnToPool_Implementation(UObject* Object) override;
+
 	/** Is overridden to change visibility according new state. */
 	virtual void OnChangedStateInPool_Implementation(EPoolObjectState NewState, UObject* InObject) override;
 };
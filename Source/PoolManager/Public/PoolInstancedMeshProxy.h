@@ -0,0 +1,83 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "UObject/Object.h"
+
+#include "PoolInstancedMeshProxy.generated.h"
+
+class AActor;
+class UInstancedStaticMeshComponent;
+class UStaticMesh;
+
+/**
+ * Is lightweight pool object that is visualized by an instance of the shared Instanced Static Mesh component.
+ * Is useful for visual-only objects like shell casings, debris chunks or markers to avoid spawning whole actor for each.
+ *
+ * To create new proxy:
+ * 1. Inherit from this class in blueprints or code.
+ * 2. Set 'Static Mesh' in defaults, all objects of the same class share one Instanced Static Mesh component.
+ * 3. Use it as any other pool object: TakeFromPool(ProxyClass, Transform) and ReturnToPool(Proxy).
+ * @see UPoolFactory_InstancedMesh
+ */
+UCLASS(Blueprintable, BlueprintType)
+class POOLMANAGER_API UPoolInstancedMeshProxy : public UObject
+{
+	GENERATED_BODY()
+
+	friend class UPoolFactory_InstancedMesh;
+
+	/*********************************************************************************************
+	 * Instance
+	 ********************************************************************************************* */
+public:
+	/** Returns the mesh that is shown by all instances of this class. */
+	UFUNCTION(BlueprintPure, Category = "[Pool Manager]")
+	UStaticMesh* GetStaticMesh() const { return StaticMesh; }
+
+	/** Returns the shared component that renders this instance. */
+	UFUNCTION(BlueprintPure, Category = "[Pool Manager]")
+	UInstancedStaticMeshComponent* GetInstancedMeshComponent() const { return InstancedMeshComponent; }
+
+	/** Returns the index of this instance in the shared component. */
+	UFUNCTION(BlueprintPure, Category = "[Pool Manager]")
+	int32 GetInstanceIndex() const { return InstanceIndex; }
+
+	/** Returns the world transform of this instance. */
+	UFUNCTION(BlueprintPure, Category = "[Pool Manager]")
+	FTransform GetInstanceTransform() const;
+
+	/** Moves this instance to the given world transform. */
+	UFUNCTION(BlueprintCallable, Category = "[Pool Manager]", meta = (AutoCreateRefTerm = "NewTransform"))
+	void SetInstanceTransform(const FTransform& NewTransform);
+
+	/*********************************************************************************************
+	 * Promotion
+	 ********************************************************************************************* */
+public:
+	/** Replaces this instance by a real actor of 'Promoted Actor Class' at the same transform when gameplay needs it.
+	 * The actor is taken from its pool immediately, while this instance is returned back to its pool.
+	 * @return the taken actor or null if 'Promoted Actor Class' is not set. */
+	UFUNCTION(BlueprintCallable, Category = "[Pool Manager]")
+	AActor* PromoteToActor();
+
+	/*********************************************************************************************
+	 * Data
+	 ********************************************************************************************* */
+protected:
+	/** The mesh that is shown by all instances of this class. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "[Pool Manager]", meta = (BlueprintProtected))
+	TObjectPtr<UStaticMesh> StaticMesh = nullptr;
+
+	/** Optional actor class to replace this instance by calling PromoteToActor(). */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "[Pool Manager]", meta = (BlueprintProtected))
+	TSubclassOf<AActor> PromotedActorClass = nullptr;
+
+	/** The shared component that renders this instance, is set by the factory. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Transient, Category = "[Pool Manager]", meta = (BlueprintProtected))
+	TObjectPtr<UInstancedStaticMeshComponent> InstancedMeshComponent = nullptr;
+
+	/** The index of this instance in the shared component, is set by the factory. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Transient, Category = "[Pool Manager]", meta = (BlueprintProtected))
+	int32 InstanceIndex = INDEX_NONE;
+};
@@ -0,0 +1,72 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "HAL/LowLevelMemTracker.h"
+
+/**
+ * Stats of the Pool Manager, can be shown live in the game by 'stat PoolManager' console command.
+ * Are compiled out in builds without stats, while CPU scopes are still visible in Unreal Insights if trace is enabled.
+ */
+DECLARE_STATS_GROUP(TEXT("Pool Manager"), STATGROUP_PoolManager, STATCAT_Advanced);
+
+// Cycle counters
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Take From Pool"), STAT_PoolManager_TakeFromPool, STATGROUP_PoolManager, POOLMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Return To Pool"), STAT_PoolManager_ReturnToPool, STATGROUP_PoolManager, POOLMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Set Object State"), STAT_PoolManager_SetObjectState, STATGROUP_PoolManager, POOLMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Process Spawn Queue"), STAT_PoolManager_ProcessSpawnQueue, STATGROUP_PoolManager, POOLMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Spawn Now"), STAT_PoolManager_SpawnNow, STATGROUP_PoolManager, POOLMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Destroy"), STAT_PoolManager_Destroy, STATGROUP_PoolManager, POOLMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Factory On Take From Pool"), STAT_PoolManager_FactoryOnTake, STATGROUP_PoolManager, POOLMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Factory On Return To Pool"), STAT_PoolManager_FactoryOnReturn, STATGROUP_PoolManager, POOLMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Factory On Changed State"), STAT_PoolManager_FactoryOnChangedState, STATGROUP_PoolManager, POOLMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Batch Tick"), STAT_PoolManager_BatchTick, STATGROUP_PoolManager, POOLMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Process Enqueued Requests"), STAT_PoolManager_ProcessEnqueued, STATGROUP_PoolManager, POOLMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Update Pool Tiers"), STAT_PoolManager_UpdateTiers, STATGROUP_PoolManager, POOLMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Publish Snapshot"), STAT_PoolManager_PublishSnapshot, STATGROUP_PoolManager, POOLMANAGER_API);
+
+// Counters that are reset every frame
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Takes"), STAT_PoolManager_Takes, STATGROUP_PoolManager, POOLMANAGER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Misses"), STAT_PoolManager_Misses, STATGROUP_PoolManager, POOLMANAGER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Spawns"), STAT_PoolManager_Spawns, STATGROUP_PoolManager, POOLMANAGER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Returns"), STAT_PoolManager_Returns, STATGROUP_PoolManager, POOLMANAGER_API);
+
+// Values that are kept between frames
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Spawn Queue Depth"), STAT_PoolManager_SpawnQueueDepth, STATGROUP_PoolManager, POOLMANAGER_API);
+
+// Estimated memory of all pools: objects and bookkeeping, is computed only while the stat group is shown
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Pooled Memory"), STAT_PoolManager_PooledMemory, STATGROUP_PoolManager, POOLMANAGER_API);
+
+// Latencies of the last spawned object by priority, Critical requests are always spawned in the same frame
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Spawn Latency Normal (ms)"), STAT_PoolManager_SpawnLatencyNormalMs, STATGROUP_PoolManager, POOLMANAGER_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Spawn Latency Medium (ms)"), STAT_PoolManager_SpawnLatencyMediumMs, STATGROUP_PoolManager, POOLMANAGER_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Spawn Latency High (ms)"), STAT_PoolManager_SpawnLatencyHighMs, STATGROUP_PoolManager, POOLMANAGER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Spawn Latency Normal (frames)"), STAT_PoolManager_SpawnLatencyNormalFrames, STATGROUP_PoolManager, POOLMANAGER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Spawn Latency Medium (frames)"), STAT_PoolManager_SpawnLatencyMediumFrames, STATGROUP_PoolManager, POOLMANAGER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Spawn Latency High (frames)"), STAT_PoolManager_SpawnLatencyHighFrames, STATGROUP_PoolManager, POOLMANAGER_API);
+
+/**
+ * Tag of the Low Level Memory tracker, so pooled objects and containers of the Pool Manager are reported separately
+ * from generic UObject and Actor buckets, e.g: by 'stat LLM' or '-llm' capture in Unreal Insights.
+ */
+LLM_DECLARE_TAG_API(PoolManager, POOLMANAGER_API);
+
+/**
+ * Categories of the CSV profiler, are recorded at the end of each frame during 'csvprofile start'.
+ * Per-class stats are recorded only if 'PoolManager.CsvPerClassStats' is enabled, since they are recorded by dynamic names.
+ */
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(POOLMANAGER_API, PoolManager);
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(POOLMANAGER_API, PoolManagerClasses);
+
+/** Measures the scope by the stat and by the CPU profiler trace for Unreal Insights.
+ * In STATS builds the cycle counter already emits the trace scope, so the explicit one is added only when stats are compiled out. */
+#if STATS
+#define POOL_MANAGER_SCOPE_CYCLE_COUNTER(Stat) \
+	SCOPE_CYCLE_COUNTER(Stat)
+#else
+#define POOL_MANAGER_SCOPE_CYCLE_COUNTER(Stat) \
+	TRACE_CPUPROFILER_EVENT_SCOPE(Stat)
+#endif // STATS
@@ -5,9 +5,22 @@
 #include "Subsystems/WorldSubsystem.h"
 
 // Pool Manager
+#include "Data/PoolBatchTickFunction.h"
 #include "Data/PoolContainer.h"
+#include "Data/PoolEnqueuedRequest.h"
+#include "Data/PoolLeakReport.h"
+#include "Data/PoolManagerCounters.h"
+#include "Data/PoolSnapshot.h"
+#include "Data/PoolSoftTake.h"
 #include "Data/SpawnRequestPriority.h"
 
+// UE
+#include "Async/Future.h"
+#include "Containers/Queue.h"
+#include "Engine/StreamableManager.h"
+
+#include <atomic>
+
 #include "PoolManagerSubsystem.generated.h"
 
 enum class EPoolObjectState : uint8;
@@ -102,14 +115,38 @@ public:
 	 * @return Handle to the object with the Hash associated with the object, is indirect since the object could be not ready yet. */
 	virtual struct FPoolObjectHandle TakeFromPool(const UClass* ObjectClass, const FTransform& Transform = FTransform::Identity, const FOnSpawnCallback& Completed = nullptr, ESpawnRequestPriority Priority = ESpawnRequestPriority::Normal);
 
+	/** Is alternative version of TakeFromPool() that prefers free objects last used with the same variant key.
+	 * Is not virtual, since it passes the key to the overridable TakeFromPool() above, so its overrides are called for keyed takes too.
+	 * @param VariantKey The key of the look or configuration, free objects last used with the same key are taken first. */
+	struct FPoolObjectHandle TakeFromPool(const UClass* ObjectClass, const FTransform& Transform, const FOnSpawnCallback& Completed, ESpawnRequestPriority Priority, FName VariantKey);
+
 	/** A templated alternative to get the object from a pool by class in template.
 	 * Is useful in code with code classes, e.g: TakeFromPool<AProjectile>(); */
 	template <typename T>
-	struct FPoolObjectHandle TakeFromPool(const FTransform& Transform = FTransform::Identity, const FOnSpawnCallback& Completed = nullptr, ESpawnRequestPriority Priority = ESpawnRequestPriority::Normal) { return TakeFromPool(T::StaticClass(), Transform, Completed, Priority); }
+	struct FPoolObjectHandle TakeFromPool(const FTransform& Transform = FTransform::Identity, const FOnSpawnCallback& Completed = nullptr, ESpawnRequestPriority Priority = ESpawnRequestPriority::Normal, FName VariantKey = NAME_None) { return TakeFromPool(T::StaticClass(), Transform, Completed, Priority, VariantKey); }
 
 	/** Is alternative version of TakeFromPool() to find object in pool or return null. */
 	virtual const struct FPoolObjectData* TakeFromPoolOrNull(const UClass* ObjectClass, const FTransform& Transform = FTransform::Identity);
 
+	/** Is alternative version of TakeFromPoolOrNull() that prefers free objects last used with the same variant key:
+	 * hot objects with the same key, then any hot object, then cold objects in the same order.
+	 * Is not virtual, since it passes the key to the overridable TakeFromPoolOrNull() above. */
+	const struct FPoolObjectData* TakeFromPoolOrNull(const UClass* ObjectClass, const FTransform& Transform, FName VariantKey);
+
+	/** Is alternative version of TakeFromPool() that returns the future instead of the callback, so it can be composed with other async work.
+	 * The future is completed on the game thread: immediately if the object is found in the pool, otherwise once it is spawned.
+	 * If the request is cancelled by returning its handle before spawning, the future is completed with invalid object data.
+	 * @param OutHandle Returns the handle associated with the object, can be passed to ReturnToPool() to cancel the request. */
+	virtual TFuture<struct FPoolObjectData> TakeFromPoolAsync(struct FPoolObjectHandle& OutHandle, const UClass* ObjectClass, const FTransform& Transform = FTransform::Identity, ESpawnRequestPriority Priority = ESpawnRequestPriority::Normal);
+
+	/** Is alternative version of TakeFromPool() that accepts soft class, so callers don't need to load it synchronously.
+	 * If the class is not loaded yet, it and all its hard dependencies (meshes, materials etc) are streamed in asynchronously first,
+	 * and only then the object is taken from the pool, so the first spawn of the class does not stall the game thread on disk I/O.
+	 * Critical requests are streamed with high loading priority.
+	 * @param OutHandle Returns the handle associated with the object, can be passed to ReturnToPool() to cancel the request even while the class is loading.
+	 * @return Handle of async loading, is null if the class is already loaded and taken immediately. */
+	virtual TSharedPtr<struct FStreamableHandle> TakeFromPoolSoft(struct FPoolObjectHandle& OutHandle, const TSoftClassPtr<UObject>& SoftObjectClass, const FTransform& Transform = FTransform::Identity, const FOnSpawnCallback& Completed = nullptr, ESpawnRequestPriority Priority = ESpawnRequestPriority::Normal);
+
 	/*********************************************************************************************
 	 * Take From Pool (multiple objects)
 	 * Use it instead of single-object version when you need to get multiple objects at once.
@@ -135,6 +172,11 @@ public:
 	 * @param Completed The callback function that is called once when all objects are ready. */
 	virtual void TakeFromPoolArray(TArray<struct FPoolObjectHandle>& OutHandles, TArray<struct FSpawnRequest>& InRequests, const FOnSpawnAllCallback& Completed = nullptr);
 
+	/** Is alternative version of TakeFromPoolArray() that returns the future completed on the game thread once all objects are ready.
+	 * If any of requests is cancelled, the future is completed only with objects that are spawned.
+	 * @param OutHandles Returns the handles associated with objects, can be passed to ReturnToPoolArray() to cancel requests. */
+	virtual TFuture<TArray<struct FPoolObjectData>> TakeFromPoolArrayAsync(TArray<struct FPoolObjectHandle>& OutHandles, const UClass* ObjectClass, int32 Amount, ESpawnRequestPriority Priority = ESpawnRequestPriority::Normal);
+
 	/** Is alternative version of TakeFromPoolArrayOrNull() to find multiple object in pool or return null.
 	 * @param OutObjects All found and taken objects, or empty array if no one is ready yet
 	 * @param InRequests Takes the classes and Transforms. */
@@ -172,6 +214,33 @@ public:
 	/** Is the same as ReturnToPool() but for multiple handle. */
 	virtual bool ReturnToPoolArray(const TArray<struct FPoolObjectHandle>& Handles);
 
+	/*********************************************************************************************
+	 * Thread-Safe Requests
+	 * Use it to take and return objects from worker threads without marshalling each call to the game thread.
+	 ********************************************************************************************* */
+public:
+	/** Is thread-safe alternative to TakeFromPool() that can be called from any thread, e.g. from async tasks.
+	 * The handle is reserved immediately, while the request is processed on the game thread at the start of next world tick.
+	 * @param ObjectClass The class of object to get from the pool.
+	 * @param Transform The transform to set for the object (if actor).
+	 * @param Completed The callback that is called on the game thread when the object is ready.
+	 * @param Priority The priority of the spawn request if there are no free objects in the pool.
+	 * @return Handle that will be associated with taken or spawned object.
+	 * If free object is taken, it keeps its own handle and the returned one is its alias until the object is returned to the pool. */
+	virtual struct FPoolObjectHandle EnqueueTakeFromPool(const UClass* ObjectClass, const FTransform& Transform = FTransform::Identity, const FOnSpawnCallback& Completed = nullptr, ESpawnRequestPriority Priority = ESpawnRequestPriority::Normal);
+
+	/** Is thread-safe alternative to ReturnToPool() by handle that can be called from any thread.
+	 * Is processed on the game thread at the start of next world tick in the same order as enqueued takes,
+	 * so it is safe to return the handle even if its take is not processed yet. */
+	virtual void EnqueueReturnToPool(const struct FPoolObjectHandle& Handle);
+
+protected:
+	/** Processes all requests enqueued from any thread in one pass, is called on the game thread at the start of each world tick. */
+	virtual void ProcessEnqueuedRequests();
+
+	/** Is bound to process enqueued requests at the start of world tick. */
+	void OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
 	/*********************************************************************************************
 	 * Advanced
 	 * In most cases, you don't need to use this section.
@@ -198,6 +267,14 @@ public:
 	/** Is the same as CreateNewObjectInPool() but for multiple objects. */
 	virtual void CreateNewObjectsArrayInPool(TArray<struct FSpawnRequest>& InRequests, TArray<struct FPoolObjectHandle>& OutAllHandles, const FOnSpawnAllCallback& Completed = nullptr);
 
+	/** Creates given amount of new objects that are returned to the pool right after spawning, so they are ready to be taken later.
+	 * Is useful to prewarm pools during loading screens.
+	 * @param ObjectClass The class of objects to create in the pool.
+	 * @param Amount The amount of objects to create.
+	 * @param Priority The priority of the requests, is Normal by default to spread spawning over multiple frames. */
+	UFUNCTION(BlueprintCallable, Category = "[Pool Manager]")
+	virtual void PrewarmPool(const UClass* ObjectClass, int32 Amount, ESpawnRequestPriority Priority = ESpawnRequestPriority::Normal);
+
 	/*********************************************************************************************
 	 * Advanced - Factories
 	 ********************************************************************************************* */
@@ -246,6 +323,75 @@ public:
 	/** Destroy all objects in Pool Manager based on a predicate functor. */
 	virtual void EmptyAllByPredicate(const TFunctionRef<bool(const UObject* PoolObject)> Predicate);
 
+	/** Destroys free objects of a pool by given class above specified amount, while taken objects are kept.
+	 * Cold objects are destroyed first since they are the slowest to be taken.
+	 * @param KeepFreeNum How many free objects to keep in the pool.
+	 * @return Number of destroyed objects. */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable)
+	int32 TrimPool(const UClass* ObjectClass, int32 KeepFreeNum = 0);
+	virtual int32 TrimPool_Implementation(const UClass* ObjectClass, int32 KeepFreeNum = 0);
+
+	/*********************************************************************************************
+	 * Batch Tick
+	 * Pools of objects that implement IPoolObjectBatchTick are ticked all at once by single tick function.
+	 ********************************************************************************************* */
+public:
+	/** Ticks all active objects of batched pools.
+	 * Is called automatically once per frame by the batch tick function of the Pool Manager.
+	 * @see IPoolObjectBatchTick */
+	virtual void TickBatchedPools(float DeltaTime);
+
+	/** Returns all objects of specified class that are currently taken from the pool.
+	 * Is dense list, so it is fast to iterate, but do not return objects to the pool while iterating it. */
+	const TArray<TObjectPtr<UObject>>& GetActiveObjects(const UClass* ObjectClass) const;
+
+	/** Iterates all active objects of specified class that are currently taken from the pool.
+	 * E.g: ForEachActiveObject<AProjectile>([](AProjectile& Projectile) { ... }); */
+	template <typename T>
+	void ForEachActiveObject(const TFunctionRef<void(T&)> Callback) const
+	{
+		for (UObject* ObjectIt : GetActiveObjects(T::StaticClass()))
+		{
+			Callback(*CastChecked<T>(ObjectIt));
+		}
+	}
+
+protected:
+	/** Registers the batch tick function in the world if it is not registered yet. */
+	virtual void RegisterBatchTickFunction();
+
+	/*********************************************************************************************
+	 * Hot/Cold Tiers
+	 * Free objects above 'Hot Objects Num' are demoted to the cold tier to release their resources.
+	 * Is enabled by 'Cold Demotion Delay' in 'Project Settings' -> "Plugins" -> "Pool Manager".
+	 ********************************************************************************************* */
+public:
+	/** Demotes free objects that stayed hot for too long to the cold tier and promotes cold objects back when there are not enough hot ones.
+	 * Is called automatically at the end of each frame, the amount of changed objects per frame is limited by 'Spawn Objects Per Frame'. */
+	virtual void UpdatePoolTiers();
+
+	/*********************************************************************************************
+	 * Leak Detection
+	 * Reports objects that are taken for longer than expected, e.g: when callers never return them.
+	 * Is enabled by 'Detect Leaks' in 'Project Settings' -> "Plugins" -> "Pool Manager".
+	 ********************************************************************************************* */
+public:
+	/** Captures the call stack of the current take and returns its id, or 0 if leak detection is disabled.
+	 * Equal call stacks share the same id, so they are stored only once, the script call stack is captured as well if taken from Blueprints. */
+	uint32 CaptureCallSite();
+
+	/** Returns readable description of the captured call site: the calling Blueprint function if any and first native functions outside the Pool Manager.
+	 * Is resolved only once per call site. */
+	FString DescribeCallSite(uint32 CallSiteId) const;
+
+	/** Returns active objects that are taken for longer than their leak threshold, grouped by class and call site.
+	 * The groups with the most objects go first. */
+	void GetLeakReport(TArray<FPoolLeakReport>& OutReport) const;
+
+	/** Logs the leak report if there are suspected objects.
+	 * Is called automatically at the end of frame every 'Leak Scan Interval' seconds. */
+	virtual void ScanForLeaks();
+
 	/*********************************************************************************************
 	 * Getters
 	 ********************************************************************************************* */
@@ -270,7 +416,7 @@ public:
 	bool IsActive(const UObject* Object) const;
 	virtual bool IsActive_Implementation(const UObject* Object) const;
 
-	/** Returns true if handled object is inactive and ready to be taken from pool. */
+	/** Returns true if handled object is inactive and ready to be taken from pool, both hot and cold objects are free. */
 	UFUNCTION(BlueprintNativeEvent, BlueprintPure, Category = "[Pool Manager]", meta = (DefaultToSelf = "Object"))
 	bool IsFreeObjectInPool(const UObject* Object) const;
 	virtual bool IsFreeObjectInPool_Implementation(const UObject* Object) const;
@@ -290,6 +436,49 @@ public:
 	int32 GetRegisteredObjectsNum(const UClass* ObjectClass) const;
 	virtual int32 GetRegisteredObjectsNum_Implementation(const UClass* ObjectClass) const;
 
+	/** Returns classes of all pools that are handled by the Pool Manager. */
+	void GetPoolClasses(TArray<const UClass*>& OutClasses) const;
+
+	/** Returns estimated memory in bytes used by a pool by given class: its objects (their own size and resources they own)
+	 * and bookkeeping of the pool (pool container with its arrays).
+	 * Is approximate and relatively slow since every object is visited, e.g: to report or enforce memory budgets per class. */
+	int64 GetPoolMemoryBytes(const UClass* ObjectClass) const;
+
+	/** Returns estimated memory in bytes used by all objects of given pool, excluding bookkeeping. */
+	static int64 GetPoolObjectsMemoryBytes(const FPoolContainer& Pool);
+
+	/** Returns estimated memory in bytes used by all pools and bookkeeping of the Pool Manager, including snapshots and captured call sites. */
+	int64 GetTotalMemoryBytes() const;
+
+	/** Returns memory in bytes of a pool by given class as it was estimated the last time: the size of one sampled object multiplied by objects num.
+	 * Unlike GetPoolMemoryBytes(), is cheap enough to be called every frame, e.g: to record stats, is refreshed by UpdateMemoryEstimates(). */
+	int64 GetEstimatedPoolMemoryBytes(const UClass* ObjectClass) const;
+
+	/** Returns memory in bytes of all pools and bookkeeping as it was estimated the last time, is refreshed by UpdateMemoryEstimates(). */
+	FORCEINLINE int64 GetEstimatedTotalMemoryBytes() const { return EstimatedTotalMemoryBytes; }
+
+	/** Refreshes estimated memory of all pools if the estimate is older than given interval in seconds.
+	 * Visits only one object per pool, so it does not stall the frame as GetTotalMemoryBytes() does. */
+	virtual void UpdateMemoryEstimates(double Interval);
+
+	/** Returns number of objects of all classes that are requested to be spawned, but are not spawned yet. */
+	int32 GetSpawnQueueNum() const;
+
+	/** Returns the histogram of latencies between requesting the spawn and receiving the spawned object, e.g: to check
+	 * whether High requests are served within 1 frame at the 99th percentile with current 'Spawn Objects Per Frame'.
+	 * @param ObjectClass If null, latencies of all classes are merged.
+	 * @param Priority If None, latencies of all priorities are merged. */
+	struct FPoolSpawnLatencyHistogram GetSpawnLatency(const UClass* ObjectClass = nullptr, ESpawnRequestPriority Priority = ESpawnRequestPriority::None) const;
+
+	/** Returns the last spawns of all factories that took longer than their 'Spawn Hitch Threshold Ms', the most recent first. */
+	void GetRecentSpawnHitches(TArray<struct FPoolSpawnHitch>& OutHitches) const;
+
+	/** Returns cumulative counters of takes, spawns and returns since initialization or the last reset. */
+	const FORCEINLINE FPoolManagerCounters& GetCounters() const { return Counters; }
+
+	/** Resets cumulative counters, e.g: to measure only the next workload. */
+	void ResetCounters() { Counters = FPoolManagerCounters(); }
+
 	/** Returns true if object is valid and registered in pool. */
 	UFUNCTION(BlueprintPure, Category = "[Pool Manager]", meta = (AutoCreateRefTerm = "InPoolObject"))
 	static bool IsPoolObjectValid(const struct FPoolObjectData& InPoolObject) { return InPoolObject.IsValid(); }
@@ -308,6 +497,65 @@ public:
 	UFUNCTION(BlueprintPure, Category = "[Pool Manager]")
 	void FindPoolObjectsByHandles(TArray<struct FPoolObjectData>& OutObjects, const TArray<struct FPoolObjectHandle>& InHandles) const;
 
+	/** Iterates all valid objects of a pool by specified class, both free and taken, e.g: for debugging tools.
+	 * Do not take or return objects while iterating. */
+	void ForEachObjectInPool(const UClass* ObjectClass, const TFunctionRef<void(const struct FPoolObjectData&)> Callback) const;
+
+	/*********************************************************************************************
+	 * Thread-Safe Getters
+	 * Read the snapshot published at the end of the last frame, so values can be one frame old.
+	 * Is enabled by 'Publish Snapshots' in 'Project Settings' -> "Plugins" -> "Pool Manager".
+	 ********************************************************************************************* */
+public:
+	/** Returns true if any snapshot is published, so thread-safe getters return actual data. */
+	bool HasPublishedSnapshot() const { return GetPublishedSnapshot().IsValid(); }
+
+	/** Returns the frame number of the last published snapshot or 0 if nothing is published yet. */
+	uint64 GetSnapshotFrameNumber() const;
+
+	/** Is thread-safe alternative to GetPoolObjectState(). */
+	EPoolObjectState GetPoolObjectStateThreadSafe(const UObject* Object) const;
+
+	/** Is thread-safe alternative to IsActive(). */
+	bool IsActiveThreadSafe(const UObject* Object) const;
+
+	/** Is thread-safe alternative to IsRegistered(). */
+	bool IsRegisteredThreadSafe(const UObject* Object) const;
+
+	/** Returns counters of the pool by specified class, can be called from any thread. */
+	FPoolClassSnapshot GetPoolSnapshotThreadSafe(const UClass* ObjectClass) const;
+
+	/** Is thread-safe alternative to GetFreeObjectsNum(). */
+	int32 GetFreeObjectsNumThreadSafe(const UClass* ObjectClass) const { return GetPoolSnapshotThreadSafe(ObjectClass).FreeObjectsNum; }
+
+	/** Is thread-safe alternative to GetRegisteredObjectsNum(). */
+	int32 GetRegisteredObjectsNumThreadSafe(const UClass* ObjectClass) const { return GetPoolSnapshotThreadSafe(ObjectClass).RegisteredObjectsNum; }
+
+	/** Reads the whole last published snapshot at once, can be called from any thread.
+	 * The snapshot is kept alive until the callback returns, even if newer snapshots are published meanwhile. */
+	void ReadSnapshot(const TFunctionRef<void(const FPoolSnapshot&)> Callback) const;
+
+	/** Returns the last published snapshot or null if nothing is published yet, can be called from any thread without locks.
+	 * Returned snapshot is immutable and stays valid for as long as the pointer is held. */
+	FPoolSnapshotPtr GetPublishedSnapshot() const;
+
+protected:
+	/** Copies the current state of all pools into new snapshot and publishes it, is called on the game thread. */
+	virtual void PublishSnapshot();
+
+	/** Releases retired snapshots if no reader is taking the reference to the published snapshot right now. */
+	void ReleaseRetiredSnapshots();
+
+	/** Returns memory in bytes used by published, retired and reusable snapshots. */
+	int64 GetSnapshotsMemoryBytes() const;
+
+	/** Is bound to update pool tiers and publish the snapshot at the end of world tick. */
+	void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	/** Records hit rate, spawn queue, spawns, returns and memory of the last frame to the CSV profiler.
+	 * Is called at the end of world tick, does nothing if CSV profiler is not capturing. */
+	virtual void RecordCsvStats();
+
 	/*********************************************************************************************
 	 * Protected properties
 	 ********************************************************************************************* */
@@ -321,6 +569,73 @@ protected:
 	UPROPERTY(BlueprintReadWrite, Transient, Category = "[Pool Manager]", meta = (BlueprintProtected))
 	TMap<TObjectPtr<const UClass>, TObjectPtr<UPoolFactory_UObject>> AllFactories;
 
+	/** Single tick function that ticks all active objects of batched pools.
+	 * @see IPoolObjectBatchTick */
+	FPoolBatchTickFunction BatchTickFunction;
+
+	/** Copy of active objects of the pool that is batch ticked right now, is reused to avoid allocations every frame. */
+	TArray<TObjectPtr<UObject>> BatchTickingObjects;
+
+	/** Objects that were returned to the pool while their batched pool is ticked, so they are skipped in this frame. */
+	TSet<const UObject*> ReturnedWhileBatchTicking;
+
+	/** Is true while batched pools are ticked. */
+	bool bIsBatchTicking = false;
+
+	/** Lock-free multi-producer queue of requests enqueued from any thread, is consumed only on the game thread. */
+	TQueue<FPoolEnqueuedRequest, EQueueMode::Mpsc> EnqueuedRequests;
+
+	/** The last published snapshot, is never modified once published, is owned and swapped only on the game thread. */
+	TSharedPtr<FPoolSnapshot, ESPMode::ThreadSafe> PublishedSnapshot;
+
+	/** Raw pointer of PublishedSnapshot that is loaded by readers of any thread without locks. */
+	std::atomic<const FPoolSnapshot*> PublishedSnapshotPtr{nullptr};
+
+	/** Number of readers that loaded PublishedSnapshotPtr, but did not take the reference to the snapshot yet.
+	 * Retired snapshots are released only when it is 0, so no reader can be left with the pointer to the freed snapshot. */
+	mutable std::atomic<int32> SnapshotReadersNum{0};
+
+	/** Snapshots replaced by newer ones that are still kept alive, since some reader could load their pointers right before the swap. */
+	TArray<TSharedPtr<FPoolSnapshot, ESPMode::ThreadSafe>> RetiredSnapshots;
+
+	/** Released snapshot that is not held by any reader, is reused by the next publish to keep its allocated memory. */
+	TSharedPtr<FPoolSnapshot, ESPMode::ThreadSafe> ReusableSnapshot;
+
+	/** Streams soft classes requested by TakeFromPoolSoft(). */
+	FStreamableManager StreamableManager;
+
+	/** Takes of soft classes by handles that were reserved by TakeFromPoolSoft(), are removed once taken objects are returned. */
+	TMap<FPoolObjectHandle, FPoolSoftTake> SoftTakes;
+
+	/** Cumulative counters of takes, spawns and returns. */
+	FPoolManagerCounters Counters;
+
+	/** Captured call stacks of takes by their ids, is filled only if leak detection is enabled. */
+	TMap<uint32, FPoolCallSite> CallSites;
+
+	/** Platform time in seconds of the last scan for leaks. */
+	double LastLeakScanTime = 0.0;
+
+	/** Index of the pool to start updating tiers from on the next frame, so all pools get their share of the per-frame budget.
+	 * @see UPoolManagerSubsystem::UpdatePoolTiers */
+	int32 TiersPoolCursor = 0;
+
+	/** The variant key of the take in progress, is set by variant overloads of TakeFromPool() and TakeFromPoolOrNull()
+	 * around the call of their overridable versions, which consume it, so nested takes from callbacks are not affected. */
+	FName TakeVariantKey = NAME_None;
+
+	/** Counters at the moment of the last recorded CSV stats, is used to get counters of each frame. */
+	FPoolManagerCounters CsvRecordedCounters;
+
+	/** Estimated memory in bytes of each pool by its class, is refreshed at low frequency by UpdateMemoryEstimates(). */
+	TMap<TObjectPtr<const UClass>, int64> EstimatedPoolsMemoryBytes;
+
+	/** Estimated memory in bytes of all pools and bookkeeping, is refreshed at low frequency by UpdateMemoryEstimates(). */
+	int64 EstimatedTotalMemoryBytes = 0;
+
+	/** Platform time in seconds of the last memory estimate. */
+	double LastMemoryEstimateTime = 0.0;
+
 	/*********************************************************************************************
 	 * Protected methods
 	 ********************************************************************************************* */
@@ -0,0 +1,60 @@
+// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "Trace/Config.h"
+
+// Pool Manager
+#include "Data/SpawnRequestPriority.h"
+
+#define POOL_MANAGER_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+
+#if POOL_MANAGER_TRACE_ENABLED
+#include "Trace/Trace.h"
+
+UE_TRACE_CHANNEL_EXTERN(PoolManagerChannel, POOLMANAGER_API);
+#endif // POOL_MANAGER_TRACE_ENABLED
+
+class UClass;
+
+/** Lifecycle events of pooled objects that are emitted to the trace. */
+enum class EPoolObjectTraceEvent : uint8
+{
+	///< The object is requested to be spawned since there are no free objects
+	Requested,
+	///< The spawn request is added to the queue of its factory
+	Queued,
+	///< The object is spawned and registered in the pool
+	Spawned,
+	///< Free object is taken from the pool
+	Taken,
+	///< The object is returned to the pool
+	Returned,
+	///< The object is destroyed by its factory
+	Destroyed,
+	///< The spawn request is cancelled by returning its handle before spawning
+	Cancelled
+};
+
+/**
+ * Emits lifecycle events of pooled objects to Unreal Insights by the 'PoolManagerChannel' trace channel.
+ * Enable it with '-trace=default,PoolManager' or 'Trace.Enable PoolManager' console command, it works on dedicated servers as well.
+ * Each event has the handle, class, priority, frame number and timestamp, so spawn queue latency and lifetimes can be calculated per handle.
+ */
+struct POOLMANAGER_API FPoolManagerTrace
+{
+	/** Emits the lifecycle event of the object by its handle, can be called from any thread. */
+	static void OutputObjectEvent(EPoolObjectTraceEvent Event, const struct FPoolObjectHandle& Handle, ESpawnRequestPriority Priority = ESpawnRequestPriority::Normal);
+
+	/** Emits the name of the class once and returns its compact id, so events can refer to the class by it, can be called from any thread.
+	 * Ids are assigned in order of first tracing and are never reused, even if the class is garbage collected.
+	 * @return Id of the class or 0 if the class is null or the channel is disabled. */
+	static uint32 OutputClass(const UClass* ObjectClass);
+};
+
+#if POOL_MANAGER_TRACE_ENABLED
+#define TRACE_POOL_OBJECT_EVENT(Event, Handle, ...) \
+	FPoolManagerTrace::OutputObjectEvent(EPoolObjectTraceEvent::Event, Handle, ##__VA_ARGS__)
+#else
+#define TRACE_POOL_OBJECT_EVENT(Event, Handle, ...)
+#endif // POOL_MANAGER_TRACE_ENABLED
@@ -24,7 +24,8 @@ public:
 	 * @param ObjectClass The class of object to spawn from the pool.
 	 * @param Transform The transform for the spawned object.
 	 * @param Priority The priority of this spawn request in the queue.
+	 * @param VariantKey Optional key of the look or configuration, free objects last used with the same key are taken first.
 	 * @return A properly initialized spawn request ready to use. */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "[Pool Manager]", meta = (NativeMakeFunc, AutoCreateRefTerm = "Transform"))
-	static struct FSpawnRequest MakeSpawnRequest(TSubclassOf<UObject> ObjectClass, const FTransform& Transform, ESpawnRequestPriority Priority = ESpawnRequestPriority::Normal);
+	static struct FSpawnRequest MakeSpawnRequest(TSubclassOf<UObject> ObjectClass, const FTransform& Transform, ESpawnRequestPriority Priority = ESpawnRequestPriority::Normal, FName VariantKey = NAME_None);
 };
@@ -0,0 +1,31 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "UObject/Interface.h"
+#include "PoolObjectBatchTick.generated.h"
+
+UINTERFACE(meta = (CannotImplementInterfaceInBlueprint))
+class UPoolObjectBatchTick : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Enables batched ticking for pool objects: implement this interface in your native pool object class to opt in.
+ * Once implemented, the Pool Manager will:
+ * - Keep per-object ticking disabled (e.g. actor tick functions are never enabled by the Actor factory).
+ * - Run a single tick function per world that iterates all active objects of such pools and calls OnPoolBatchTick().
+ * It removes the per-object tick dispatch cost, that is noticeable with thousands of active objects like bullets.
+ */
+class POOLMANAGER_API IPoolObjectBatchTick
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Is called once per frame for each active object of the pool, is called only on the game thread.
+	 * @param DeltaTime The time since the last tick.
+	 */
+	virtual void OnPoolBatchTick(float DeltaTime) = 0;
+};
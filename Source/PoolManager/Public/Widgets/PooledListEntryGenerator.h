@@ -0,0 +1,44 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "Templates/SubclassOf.h"
+
+#include "PooledListEntryGenerator.generated.h"
+
+class STableViewBase;
+class UListViewBase;
+class UUserWidget;
+
+/**
+ * Generates entry widgets of list views through the Pool Manager instead of their own private pools.
+ * It allows to prewarm entries during loading screens and share them across all screens with the same entry class.
+ * Is used by UPooledListView and UPooledTileView, could be used by any custom UListView-derived widget:
+ * - Keep it as UPROPERTY of the list view, so taken entries are referenced.
+ * - Call GenerateEntry() from overridden OnGenerateEntryWidgetInternal().
+ * - Call ReleaseEntry() on OnEntryWidgetReleased() and ReleaseAllEntries() on ReleaseSlateResources().
+ */
+USTRUCT()
+struct POOLMANAGER_API FPooledListEntryGenerator
+{
+	GENERATED_BODY()
+
+	/** Takes the entry widget of given class from the pool and wraps it into the table row of given list view.
+	 * If there are no free entries in the pool, new one is created immediately. */
+	UUserWidget& GenerateEntry(UListViewBase& ListView, TSubclassOf<UUserWidget> EntryClass, const TSharedRef<STableViewBase>& OwnerTable);
+
+	/** Releases Slate resources of the entry widget and returns it back to the pool to be reused by any list view.
+	 * Does nothing if the entry was not generated by this generator. */
+	void ReleaseEntry(UUserWidget& EntryWidget);
+
+	/** Returns all remaining entries back to the pool, e.g: when rows are destroyed together with the table without releasing their entries. */
+	void ReleaseAllEntries();
+
+protected:
+	/** Releases Slate resources of the entry widget and returns it back to the pool. */
+	static void ReturnEntryToPool(UUserWidget& EntryWidget);
+
+	/** All entry widgets that are currently taken by the list view from the Pool Manager. */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UUserWidget>> PooledEntries;
+};
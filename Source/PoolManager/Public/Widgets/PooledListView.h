@@ -0,0 +1,40 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "Components/ListView.h"
+
+// Pool Manager
+#include "Widgets/PooledListEntryGenerator.h"
+
+#include "PooledListView.generated.h"
+
+/**
+ * Is the List View that takes its entry widgets from the Pool Manager instead of its own private pool.
+ * Entries are returned back to the Pool Manager once released, so they are shared across all screens with the same entry class.
+ * Prewarm entries during loading screens with UPoolManagerSubsystem::PrewarmPool(EntryClass, Amount).
+ * @see FPooledListEntryGenerator
+ */
+UCLASS(meta = (DisplayName = "Pooled List View"))
+class POOLMANAGER_API UPooledListView : public UListView
+{
+	GENERATED_BODY()
+
+public:
+	/** Default constructor. */
+	UPooledListView(const FObjectInitializer& ObjectInitializer);
+
+	/** Is overridden to return all remaining entries back to the Pool Manager. */
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+
+protected:
+	/** Is overridden to take the entry widget from the Pool Manager. */
+	virtual UUserWidget& OnGenerateEntryWidgetInternal(UObject* Item, TSubclassOf<UUserWidget> DesiredEntryClass, const TSharedRef<STableViewBase>& OwnerTable) override;
+
+	/** Is bound to return released entry widget back to the Pool Manager. */
+	void OnPooledEntryReleased(UUserWidget& EntryWidget);
+
+	/** Takes entry widgets of this list from the Pool Manager and returns them back. */
+	UPROPERTY(Transient)
+	FPooledListEntryGenerator EntryGenerator;
+};
@@ -0,0 +1,29 @@
+﻿// Copyright (c) Yevhenii Selivanov.
+
+using UnrealBuildTool;
+
+public class PoolManagerDebug : ModuleRules
+{
+	public PoolManagerDebug(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+		CppCompileWarningSettings.NonInlinedGenCppWarningLevel = WarningLevel.Error;
+
+		PublicDependencyModuleNames.AddRange(new[]
+			{
+				"Core"
+			}
+		);
+
+		PrivateDependencyModuleNames.AddRange(new[]
+			{
+				"CoreUObject", "Engine" // Core
+				// My modules
+				, "PoolManager"
+			}
+		);
+
+		// Pool Manager category of the Gameplay Debugger, is compiled out in Shipping
+		SetupGameplayDebuggerSupport(Target);
+	}
+}
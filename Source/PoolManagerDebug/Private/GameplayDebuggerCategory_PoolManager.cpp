@@ -0,0 +1,158 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "GameplayDebuggerCategory_PoolManager.h"
+
+#if WITH_GAMEPLAY_DEBUGGER_MENU
+
+// Pool Manager
+#include "PoolManagerSubsystem.h"
+#include "Data/PoolObjectData.h"
+#include "Data/PoolObjectState.h"
+#include "Data/PoolSpawnLatency.h"
+#include "Factories/PoolFactory_UObject.h"
+
+// UE
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/PlayerController.h"
+
+// Default constructor
+FGameplayDebuggerCategory_PoolManager::FGameplayDebuggerCategory_PoolManager()
+{
+	SetDataPackReplication<FRepData>(&DataPack);
+
+	// Pools and nearest actors are visited on each collect, so it is not done every frame
+	CollectDataInterval = 0.5f;
+}
+
+// Creates new instance of this category
+TSharedRef<FGameplayDebuggerCategory> FGameplayDebuggerCategory_PoolManager::MakeInstance()
+{
+	return MakeShared<FGameplayDebuggerCategory_PoolManager>();
+}
+
+// Is overridden to collect the data of the Pool Manager on the authority
+void FGameplayDebuggerCategory_PoolManager::CollectData(APlayerController* OwnerPC, AActor* DebugActor)
+{
+	DataPack = FRepData();
+
+	const UWorld* World = OwnerPC ? OwnerPC->GetWorld() : nullptr;
+	UPoolManagerSubsystem* PoolManager = World ? World->GetSubsystem<UPoolManagerSubsystem>() : nullptr;
+	if (!PoolManager)
+	{
+		DataPack.Summary = TEXT("{red}Pool Manager is not available in this world");
+		return;
+	}
+
+	TArray<const UClass*> PoolClasses;
+	PoolManager->GetPoolClasses(/*out*/ PoolClasses);
+
+	// Exact memory visits resources of every pooled object, so the estimate refreshed once per second is shown instead
+	PoolManager->UpdateMemoryEstimates(1.0);
+
+	const FPoolManagerCounters& Counters = PoolManager->GetCounters();
+	DataPack.Summary = FString::Printf(TEXT("Pools: {yellow}%i{white}  Spawn queue: {yellow}%i{white}  Hit rate: {yellow}%.1f%%{white}  Spawns: {yellow}%lld{white}  Memory: {yellow}%.1f KB"),
+	                                   PoolClasses.Num(), PoolManager->GetSpawnQueueNum(), Counters.GetHitRate() * 100.0, Counters.SpawnsNum,
+	                                   PoolManager->GetEstimatedTotalMemoryBytes() / 1024.0);
+
+	// Pools and nearest actors
+	const FVector DebugLocation = DebugActor ? DebugActor->GetActorLocation()
+		                              : OwnerPC->GetPawn() ? OwnerPC->GetPawn()->GetActorLocation() : FVector::ZeroVector;
+	constexpr int32 MaxNearestActors = 5;
+	TArray<TPair<double, const FPoolObjectData*>> NearestActors;
+
+	for (const UClass* ClassIt : PoolClasses)
+	{
+		const int32 FreeNum = PoolManager->GetFreeObjectsNum(ClassIt);
+		const int32 RegisteredNum = PoolManager->GetRegisteredObjectsNum(ClassIt);
+		const int32 QueuedNum = PoolManager->FindPoolFactoryChecked(ClassIt)->GetSpawnQueueNum(ClassIt);
+		const float FreeRatio = RegisteredNum > 0 ? static_cast<float>(FreeNum) / RegisteredNum : 0.f;
+		const FPoolSpawnLatencyHistogram SpawnLatency = PoolManager->GetSpawnLatency(ClassIt);
+
+		// Highlight pools that have no free objects while objects are still requested
+		const TCHAR* NameColor = FreeNum == 0 && QueuedNum > 0 ? TEXT("{red}") : TEXT("{green}");
+		DataPack.PoolLines.Emplace(FString::Printf(TEXT("%s%s{white}  free %i / active %i (%.0f%% free)  queued %i  latency p99 %i frames"),
+		                                           NameColor, *ClassIt->GetName(), FreeNum, RegisteredNum - FreeNum, FreeRatio * 100.f, QueuedNum,
+		                                           SpawnLatency.GetPercentileFrames(99.f)));
+
+		if (!ClassIt->IsChildOf<AActor>())
+		{
+			continue;
+		}
+
+		PoolManager->ForEachObjectInPool(ClassIt, [&NearestActors, &DebugLocation](const FPoolObjectData& PoolObjectData)
+		{
+			const AActor* Actor = CastChecked<AActor>(PoolObjectData.PoolObject);
+			NearestActors.Emplace(FVector::DistSquared(Actor->GetActorLocation(), DebugLocation), &PoolObjectData);
+		});
+	}
+
+	// Keep only the nearest actors
+	NearestActors.Sort([](const TPair<double, const FPoolObjectData*>& A, const TPair<double, const FPoolObjectData*>& B) { return A.Key < B.Key; });
+	const UEnum* StateEnum = StaticEnum<EPoolObjectState>();
+	for (int32 Index = 0; Index < FMath::Min(NearestActors.Num(), MaxNearestActors); ++Index)
+	{
+		const FPoolObjectData& PoolObjectData = *NearestActors[Index].Value;
+		const AActor* Actor = CastChecked<AActor>(PoolObjectData.PoolObject);
+		const EPoolObjectState State = PoolObjectData.GetState();
+		const FString StateName = StateEnum->GetNameStringByValue(static_cast<int64>(State));
+		const FString Description = FString::Printf(TEXT("%s (%s)"), *Actor->GetName(), *StateName);
+		DataPack.NearestLines.Emplace(FString::Printf(TEXT("{yellow}%s{white}  %.0f cm"), *Description, FMath::Sqrt(NearestActors[Index].Key)));
+
+		FVector Origin = FVector::ZeroVector;
+		FVector Extent = FVector::ZeroVector;
+		Actor->GetActorBounds(/*bOnlyCollidingComponents*/ false, /*out*/ Origin, /*out*/ Extent);
+		const FColor Color = State == EPoolObjectState::Active ? FColor::Green : FColor::Silver;
+		AddShape(FGameplayDebuggerShape::MakeBox(Origin, Extent, Color, Description));
+	}
+
+	// Recent spawn hitches
+	TArray<FPoolSpawnHitch> SpawnHitches;
+	PoolManager->GetRecentSpawnHitches(/*out*/ SpawnHitches);
+	for (const FPoolSpawnHitch& HitchIt : SpawnHitches)
+	{
+		const UClass* HitchClass = HitchIt.ObjectClass.Get();
+		DataPack.HitchLines.Emplace(FString::Printf(TEXT("{orange}%s{white}  %.2f ms  %llu frames ago"),
+		                                            HitchClass ? *HitchClass->GetName() : TEXT("None"), HitchIt.DurationMs, GFrameCounter - HitchIt.FrameNumber));
+	}
+}
+
+// Is overridden to print collected data on the local client
+void FGameplayDebuggerCategory_PoolManager::DrawData(APlayerController* OwnerPC, FGameplayDebuggerCanvasContext& CanvasContext)
+{
+	CanvasContext.Print(DataPack.Summary);
+
+	for (const FString& It : DataPack.PoolLines)
+	{
+		CanvasContext.Print(It);
+	}
+
+	if (!DataPack.HitchLines.IsEmpty())
+	{
+		CanvasContext.Print(TEXT("{white}Recent spawn hitches:"));
+		for (const FString& It : DataPack.HitchLines)
+		{
+			CanvasContext.Print(It);
+		}
+	}
+
+	if (!DataPack.NearestLines.IsEmpty())
+	{
+		CanvasContext.Print(TEXT("{white}Nearest pooled actors:"));
+		for (const FString& It : DataPack.NearestLines)
+		{
+			CanvasContext.Print(It);
+		}
+	}
+}
+
+// Serializes the data to be replicated
+void FGameplayDebuggerCategory_PoolManager::FRepData::Serialize(FArchive& Ar)
+{
+	Ar << Summary;
+	Ar << PoolLines;
+	Ar << HitchLines;
+	Ar << NearestLines;
+}
+
+#endif // WITH_GAMEPLAY_DEBUGGER_MENU
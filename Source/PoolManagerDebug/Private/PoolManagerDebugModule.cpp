@@ -0,0 +1,42 @@
+﻿// Copyright (c) Yevhenii Selivanov.
+
+#include "PoolManagerDebugModule.h"
+
+// Pool Manager
+#include "GameplayDebuggerCategory_PoolManager.h"
+
+// UE
+#include "Modules/ModuleManager.h"
+
+#if WITH_GAMEPLAY_DEBUGGER_MENU
+#include "GameplayDebugger.h"
+#endif
+
+void FPoolManagerDebugModule::StartupModule()
+{
+	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+
+#if WITH_GAMEPLAY_DEBUGGER_MENU
+	// Show the state of pools in the Gameplay Debugger
+	IGameplayDebugger& GameplayDebuggerModule = IGameplayDebugger::Get();
+	GameplayDebuggerModule.RegisterCategory(TEXT("PoolManager"), IGameplayDebugger::FOnGetCategory::CreateStatic(&FGameplayDebuggerCategory_PoolManager::MakeInstance), EGameplayDebuggerCategoryState::EnabledInGameAndSimulate);
+	GameplayDebuggerModule.NotifyCategoriesChanged();
+#endif
+}
+
+void FPoolManagerDebugModule::ShutdownModule()
+{
+	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
+	// we call this function before unloading the module.
+
+#if WITH_GAMEPLAY_DEBUGGER_MENU
+	if (IGameplayDebugger::IsAvailable())
+	{
+		IGameplayDebugger& GameplayDebuggerModule = IGameplayDebugger::Get();
+		GameplayDebuggerModule.UnregisterCategory(TEXT("PoolManager"));
+		GameplayDebuggerModule.NotifyCategoriesChanged();
+	}
+#endif
+}
+
+IMPLEMENT_MODULE(FPoolManagerDebugModule, PoolManagerDebug)
@@ -0,0 +1,56 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#if WITH_GAMEPLAY_DEBUGGER_MENU
+
+// UE
+#include "GameplayDebuggerCategory.h"
+
+/**
+ * Shows the state of the Pool Manager in the Gameplay Debugger (apostrophe key in game or in PIE):
+ * pool sizes with free/active ratios, spawn queue depth, spawn latency, recent spawn hitches,
+ * and the pooled actors nearest to the debug actor.
+ * Is registered by the debug module, so it is available in cooked Development and Test builds including dedicated servers,
+ * but is compiled out of Shipping together with the Gameplay Debugger.
+ */
+class FGameplayDebuggerCategory_PoolManager : public FGameplayDebuggerCategory
+{
+public:
+	/** Default constructor. */
+	FGameplayDebuggerCategory_PoolManager();
+
+	/** Creates new instance of this category, is bound on registration. */
+	static TSharedRef<FGameplayDebuggerCategory> MakeInstance();
+
+	/** Is overridden to collect the data of the Pool Manager on the authority. */
+	virtual void CollectData(APlayerController* OwnerPC, AActor* DebugActor) override;
+
+	/** Is overridden to print collected data on the local client. */
+	virtual void DrawData(APlayerController* OwnerPC, FGameplayDebuggerCanvasContext& CanvasContext) override;
+
+protected:
+	/** Is the data replicated from the authority to the client that shows the category. */
+	struct FRepData
+	{
+		/** Summary of the whole Pool Manager. */
+		FString Summary;
+
+		/** One line per pool. */
+		TArray<FString> PoolLines;
+
+		/** One line per recent spawn hitch. */
+		TArray<FString> HitchLines;
+
+		/** One line per pooled actor nearest to the debug actor. */
+		TArray<FString> NearestLines;
+
+		/** Serializes the data to be replicated. */
+		void Serialize(FArchive& Ar);
+	};
+
+	/** The data that is collected and shown. */
+	FRepData DataPack;
+};
+
+#endif // WITH_GAMEPLAY_DEBUGGER_MENU
@@ -21,6 +21,8 @@ public class PoolManagerEditor : ModuleRules
 				"CoreUObject", "Engine", "Slate", "SlateCore" // Core
 				, "UnrealEd"
 				, "KismetCompiler"
+				, "Json" // Commandlet reports
+				, "UMG" // Soak commandlet widgets
 				// My modules
 				, "PoolManager"
 			}
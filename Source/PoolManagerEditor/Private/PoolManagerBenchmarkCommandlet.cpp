@@ -0,0 +1,129 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "PoolManagerBenchmarkCommandlet.h"
+
+// Pool Manager
+#include "PoolManagerSubsystem.h"
+#include "Data/PoolObjectData.h"
+
+// UE
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PoolManagerBenchmarkCommandlet)
+
+DEFINE_LOG_CATEGORY_STATIC(LogPoolManagerBenchmark, Log, All);
+
+// Is overridden to run all benchmarks
+int32 UPoolManagerBenchmarkCommandlet::Main(const FString& Params)
+{
+	const TArray<int32> PoolSizes = ParseIntArray(Params, TEXT("PoolSizes="), {10, 1000, 10000, 100000});
+	FParse::Value(*Params, TEXT("OpsPerSample="), OpsPerSample);
+	FParse::Value(*Params, TEXT("MaxFrames="), MaxFrames);
+	OpsPerSample = FMath::Max(1, OpsPerSample);
+	MaxFrames = FMath::Max(1, MaxFrames);
+
+	Results.Reset();
+
+	for (const int32 PoolSize : PoolSizes)
+	{
+		if (PoolSize > 0)
+		{
+			RunSample(PoolSize);
+		}
+	}
+
+	const TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+	Report->SetArrayField(TEXT("results"), Results);
+
+	const FString ReportPath = WriteJsonReport(TEXT("Benchmark.json"), Report);
+	UE_LOG(LogPoolManagerBenchmark, Display, TEXT("Report: %s"), ReportPath.IsEmpty() ? TEXT("failed to write") : *ReportPath);
+
+	return !ReportPath.IsEmpty() ? 0 : 1;
+}
+
+// Measures all operations on the pool of given size
+void UPoolManagerBenchmarkCommandlet::RunSample(int32 PoolSize)
+{
+	CreatePoolWorld();
+	UPoolManagerSubsystem& PoolManager = GetPoolManagerChecked();
+	const UClass* ObjectClass = UPoolBenchmarkObject::StaticClass();
+	const int32 OpsNum = FMath::Min(OpsPerSample, PoolSize);
+
+	// Prewarm: every object is spawned and returned in the same frame
+	uint64 StartCycles = FPlatformTime::Cycles64();
+	PoolManager.PrewarmPool(ObjectClass, PoolSize, ESpawnRequestPriority::Critical);
+	AddResult(PoolSize, TEXT("Prewarm"), PoolSize, StartCycles);
+
+	// Take and return one by one
+	TArray<FPoolObjectHandle> Handles;
+	Handles.Reserve(OpsNum);
+	StartCycles = FPlatformTime::Cycles64();
+	for (int32 Index = 0; Index < OpsNum; ++Index)
+	{
+		Handles.Emplace(PoolManager.TakeFromPool(ObjectClass));
+	}
+	AddResult(PoolSize, TEXT("TakeFromPool"), OpsNum, StartCycles);
+
+	StartCycles = FPlatformTime::Cycles64();
+	for (int32 Index = 0; Index < OpsNum; ++Index)
+	{
+		const FPoolObjectData& ObjectData = PoolManager.FindPoolObjectByHandle(Handles[Index]);
+		ensureMsgf(ObjectData.IsValid(), TEXT("ASSERT: [%i] %hs:\n'ObjectData' is not valid!"), __LINE__, __FUNCTION__);
+	}
+	AddResult(PoolSize, TEXT("FindPoolObjectByHandle"), OpsNum, StartCycles);
+
+	StartCycles = FPlatformTime::Cycles64();
+	for (const FPoolObjectHandle& It : Handles)
+	{
+		PoolManager.ReturnToPool(It);
+	}
+	AddResult(PoolSize, TEXT("ReturnToPool"), OpsNum, StartCycles);
+
+	// Take and return all at once
+	Handles.Reset();
+	StartCycles = FPlatformTime::Cycles64();
+	PoolManager.TakeFromPoolArray(/*out*/ Handles, ObjectClass, OpsNum);
+	AddResult(PoolSize, TEXT("TakeFromPoolArray"), OpsNum, StartCycles);
+
+	StartCycles = FPlatformTime::Cycles64();
+	PoolManager.ReturnToPoolArray(Handles);
+	AddResult(PoolSize, TEXT("ReturnToPoolArray"), OpsNum, StartCycles);
+
+	// Spawn queue throughput: objects are spawned by the budget of each frame
+	PoolManager.EmptyPool(ObjectClass);
+	Handles.Reset();
+	PoolManager.TakeFromPoolArray(/*out*/ Handles, ObjectClass, PoolSize);
+
+	int32 FramesNum = 0;
+	StartCycles = FPlatformTime::Cycles64();
+	while (PoolManager.GetRegisteredObjectsNum(ObjectClass) < PoolSize
+	       && FramesNum < MaxFrames)
+	{
+		TickPoolWorld(1.f / 60.f);
+		++FramesNum;
+	}
+	const int32 SpawnedNum = PoolManager.GetRegisteredObjectsNum(ObjectClass);
+	AddResult(PoolSize, TEXT("SpawnQueue"), SpawnedNum, StartCycles);
+	UE_LOG(LogPoolManagerBenchmark, Display, TEXT("Pool %i: spawned %i objects in %i frames"), PoolSize, SpawnedNum, FramesNum);
+
+	PoolManager.ReturnToPoolArray(Handles);
+	DestroyPoolWorld();
+}
+
+// Adds the measurement to the report
+void UPoolManagerBenchmarkCommandlet::AddResult(int32 PoolSize, const TCHAR* Operation, int32 OpsNum, uint64 StartCycles)
+{
+	const double TotalMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+	const double NsPerOp = OpsNum > 0 ? TotalMs * 1000000.0 / OpsNum : 0.0;
+
+	const TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetNumberField(TEXT("pool_size"), PoolSize);
+	Result->SetStringField(TEXT("operation"), Operation);
+	Result->SetNumberField(TEXT("ops"), OpsNum);
+	Result->SetNumberField(TEXT("total_ms"), TotalMs);
+	Result->SetNumberField(TEXT("ns_per_op"), NsPerOp);
+	Results.Emplace(MakeShared<FJsonValueObject>(Result));
+
+	UE_LOG(LogPoolManagerBenchmark, Display, TEXT("Pool %i: %s x%i = %.3f ms (%.1f ns/op)"), PoolSize, Operation, OpsNum, TotalMs, NsPerOp);
+}
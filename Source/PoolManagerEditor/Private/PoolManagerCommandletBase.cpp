@@ -0,0 +1,106 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "PoolManagerCommandletBase.h"
+
+// Pool Manager
+#include "PoolManagerHeadlessWorld.h"
+#include "PoolManagerSubsystem.h"
+
+// UE
+#include "Dom/JsonObject.h"
+#include "Engine/World.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PoolManagerCommandletBase)
+
+// Default constructor
+UPoolManagerCommandletBase::UPoolManagerCommandletBase()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+// Creates empty game world where objects are pooled
+UWorld* UPoolManagerCommandletBase::CreatePoolWorld()
+{
+	DestroyPoolWorld();
+
+	PoolWorld = FPoolManagerHeadlessWorld::Create(TEXT("PoolManagerCommandletWorld"));
+	return PoolWorld;
+}
+
+// Destroys the world created by CreatePoolWorld()
+void UPoolManagerCommandletBase::DestroyPoolWorld()
+{
+	if (!PoolWorld)
+	{
+		return;
+	}
+
+	UWorld* WorldToDestroy = PoolWorld;
+	PoolWorld = nullptr;
+	FPoolManagerHeadlessWorld::Destroy(WorldToDestroy);
+}
+
+// Ticks the world once, so spawn queues, timers and end of frame updates of the Pool Manager are processed
+void UPoolManagerCommandletBase::TickPoolWorld(float DeltaSeconds)
+{
+	checkf(PoolWorld, TEXT("ERROR: [%i] %hs:\n'PoolWorld' is null, call CreatePoolWorld() first!"), __LINE__, __FUNCTION__);
+	FPoolManagerHeadlessWorld::Tick(*PoolWorld, DeltaSeconds);
+}
+
+// Returns the Pool Manager of created world
+UPoolManagerSubsystem& UPoolManagerCommandletBase::GetPoolManagerChecked() const
+{
+	checkf(PoolWorld, TEXT("ERROR: [%i] %hs:\n'PoolWorld' is null, call CreatePoolWorld() first!"), __LINE__, __FUNCTION__);
+
+	UPoolManagerSubsystem* PoolManager = PoolWorld->GetSubsystem<UPoolManagerSubsystem>();
+	checkf(PoolManager, TEXT("ERROR: [%i] %hs:\n'PoolManager' is not created for the world!"), __LINE__, __FUNCTION__);
+	return *PoolManager;
+}
+
+// Writes given text to 'Saved/PoolManager/<FileName>'
+FString UPoolManagerCommandletBase::WriteTextReport(const FString& FileName, const FString& Text)
+{
+	const FString FilePath = FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("PoolManager") / FileName);
+	return FFileHelper::SaveStringToFile(Text, *FilePath) ? FilePath : FString();
+}
+
+// Writes given JSON object to 'Saved/PoolManager/<FileName>'
+FString UPoolManagerCommandletBase::WriteJsonReport(const FString& FileName, const TSharedRef<FJsonObject>& JsonObject)
+{
+	FString JsonString;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
+	if (!FJsonSerializer::Serialize(JsonObject, Writer))
+	{
+		return FString();
+	}
+
+	return WriteTextReport(FileName, JsonString);
+}
+
+// Parses comma separated integers from the command line
+TArray<int32> UPoolManagerCommandletBase::ParseIntArray(const FString& Params, const TCHAR* Key, const TArray<int32>& DefaultValues)
+{
+	FString ValuesString;
+	if (!FParse::Value(*Params, Key, ValuesString, /*bShouldStopOnSeparator*/ false))
+	{
+		return DefaultValues;
+	}
+
+	TArray<FString> ValueStrings;
+	ValuesString.ParseIntoArray(ValueStrings, TEXT(","));
+
+	TArray<int32> Values;
+	for (const FString& It : ValueStrings)
+	{
+		Values.Emplace(FCString::Atoi(*It));
+	}
+	return Values.IsEmpty() ? DefaultValues : Values;
+}
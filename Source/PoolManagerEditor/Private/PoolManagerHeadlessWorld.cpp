@@ -0,0 +1,75 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "PoolManagerHeadlessWorld.h"
+
+// Pool Manager
+#include "PoolManagerSubsystem.h"
+#include "Factories/PoolFactory_UObject.h"
+
+// UE
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "UObject/UObjectGlobals.h"
+
+// Creates empty game world where objects are pooled
+UWorld* FPoolManagerHeadlessWorld::Create(FName WorldName)
+{
+	checkf(GEngine, TEXT("ERROR: [%i] %hs:\n'GEngine' is null!"), __LINE__, __FUNCTION__);
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, /*bInformEngineOfWorld*/ false, WorldName);
+	checkf(World, TEXT("ERROR: [%i] %hs:\n'World' failed to be created!"), __LINE__, __FUNCTION__);
+
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	return World;
+}
+
+// Destroys the world created by Create() and collects its garbage
+void FPoolManagerHeadlessWorld::Destroy(UWorld* World)
+{
+	if (!World)
+	{
+		return;
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(/*bInformEngineOfWorld*/ false);
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+}
+
+// Ticks the world once
+void FPoolManagerHeadlessWorld::Tick(UWorld& World, float DeltaSeconds)
+{
+	// Timers are ticked only once per engine frame, while the world can be ticked many times within the same frame here,
+	// the global frame counter is not advanced since other systems rely on it, so spawn queues are processed directly instead
+	const bool bTimersTickedThisFrame = World.GetTimerManager().HasBeenTickedThisFrame();
+
+	World.Tick(LEVELTICK_All, DeltaSeconds);
+
+	UPoolManagerSubsystem* PoolManager = World.GetSubsystem<UPoolManagerSubsystem>();
+	if (!bTimersTickedThisFrame
+	    || !PoolManager)
+	{
+		return;
+	}
+
+	TArray<const UClass*> PoolClasses;
+	PoolManager->GetPoolClasses(/*out*/ PoolClasses);
+
+	TSet<UPoolFactory_UObject*> Factories;
+	for (const UClass* ClassIt : PoolClasses)
+	{
+		Factories.Add(PoolManager->FindPoolFactoryChecked(ClassIt));
+	}
+
+	for (UPoolFactory_UObject* FactoryIt : Factories)
+	{
+		FactoryIt->ProcessScheduledSpawnNow();
+	}
+}
@@ -0,0 +1,225 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "PoolManagerSoakCommandlet.h"
+
+// Pool Manager
+#include "PoolManagerBenchmarkCommandlet.h"
+#include "PoolManagerSubsystem.h"
+
+// UE
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformMemory.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PoolManagerSoakCommandlet)
+
+DEFINE_LOG_CATEGORY_STATIC(LogPoolManagerSoak, Log, All);
+
+// Is overridden to run all requested scenarios
+int32 UPoolManagerSoakCommandlet::Main(const FString& Params)
+{
+	float DurationMinutes = 1.f;
+	FParse::Value(*Params, TEXT("Minutes="), DurationMinutes);
+	FParse::Value(*Params, TEXT("FrameRate="), FrameRate);
+	FParse::Value(*Params, TEXT("Scale="), Scale);
+	DurationSeconds = FMath::Max(DurationMinutes * 60.f, 1.f);
+	FrameRate = FMath::Max(FrameRate, 1.f);
+	Scale = FMath::Max(Scale, 0.f);
+
+	TArray<FPoolSoakScenario> Scenarios;
+	MakeScenarios(/*out*/ Scenarios);
+
+	FString ScenarioNamesString;
+	TArray<FString> ScenarioNames;
+	if (FParse::Value(*Params, TEXT("Scenarios="), ScenarioNamesString, /*bShouldStopOnSeparator*/ false))
+	{
+		ScenarioNamesString.ParseIntoArray(ScenarioNames, TEXT(","));
+	}
+
+	bool bSucceed = true;
+	TArray<TSharedPtr<FJsonValue>> Summaries;
+	for (const FPoolSoakScenario& ScenarioIt : Scenarios)
+	{
+		if (!ScenarioNames.IsEmpty()
+		    && !ScenarioNames.Contains(ScenarioIt.Name))
+		{
+			continue;
+		}
+
+		const TSharedPtr<FJsonValue> Summary = RunScenario(ScenarioIt);
+		bSucceed &= Summary.IsValid();
+		if (Summary.IsValid())
+		{
+			Summaries.Emplace(Summary);
+		}
+	}
+
+	const TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+	Report->SetNumberField(TEXT("duration_s"), DurationSeconds);
+	Report->SetNumberField(TEXT("frame_rate"), FrameRate);
+	Report->SetNumberField(TEXT("scale"), Scale);
+	Report->SetArrayField(TEXT("scenarios"), Summaries);
+
+	const FString ReportPath = WriteJsonReport(TEXT("Soak.json"), Report);
+	UE_LOG(LogPoolManagerSoak, Display, TEXT("Report: %s"), ReportPath.IsEmpty() ? TEXT("failed to write") : *ReportPath);
+
+	return bSucceed && !ReportPath.IsEmpty() ? 0 : 1;
+}
+
+// Returns all known scenarios: bullet-hell burst, sustained fire, wave clear and UI churn
+void UPoolManagerSoakCommandlet::MakeScenarios(TArray<FPoolSoakScenario>& OutScenarios) const
+{
+	const UClass* ObjectClass = UPoolBenchmarkObject::StaticClass();
+	const UClass* ActorClass = AActor::StaticClass();
+	const UClass* WidgetClass = UPoolSoakWidget::StaticClass();
+
+	// Short lived projectiles in large bursts with a few urgent actors
+	FPoolSoakScenario& BulletHell = OutScenarios.AddDefaulted_GetRef();
+	BulletHell.Name = TEXT("BulletHell");
+	BulletHell.Waves.Add({ObjectClass, /*Interval*/ 1.f, /*Amount*/ 2000, /*Lifetime*/ 0.5f, ESpawnRequestPriority::High});
+	BulletHell.Waves.Add({ActorClass, /*Interval*/ 1.f, /*Amount*/ 50, /*Lifetime*/ 0.5f, ESpawnRequestPriority::Critical});
+
+	// Steady stream of objects every frame
+	FPoolSoakScenario& SustainedFire = OutScenarios.AddDefaulted_GetRef();
+	SustainedFire.Name = TEXT("SustainedFire");
+	SustainedFire.Waves.Add({ActorClass, /*Interval*/ 0.f, /*Amount*/ 10, /*Lifetime*/ 2.f, ESpawnRequestPriority::Normal});
+	SustainedFire.Waves.Add({ObjectClass, /*Interval*/ 0.f, /*Amount*/ 30, /*Lifetime*/ 1.f, ESpawnRequestPriority::Normal});
+
+	// Large waves of actors that are cleared all at once
+	FPoolSoakScenario& WaveClear = OutScenarios.AddDefaulted_GetRef();
+	WaveClear.Name = TEXT("WaveClear");
+	WaveClear.Waves.Add({ActorClass, /*Interval*/ 10.f, /*Amount*/ 300, /*Lifetime*/ 8.f, ESpawnRequestPriority::Medium});
+	WaveClear.Waves.Add({ObjectClass, /*Interval*/ 10.f, /*Amount*/ 1000, /*Lifetime*/ 8.f, ESpawnRequestPriority::Normal});
+
+	// Frequently opened and closed widgets, e.g: damage numbers and notifications
+	FPoolSoakScenario& UIChurn = OutScenarios.AddDefaulted_GetRef();
+	UIChurn.Name = TEXT("UIChurn");
+	UIChurn.Waves.Add({WidgetClass, /*Interval*/ 0.1f, /*Amount*/ 20, /*Lifetime*/ 1.f, ESpawnRequestPriority::Normal});
+	UIChurn.Waves.Add({ObjectClass, /*Interval*/ 0.1f, /*Amount*/ 50, /*Lifetime*/ 1.f, ESpawnRequestPriority::Normal});
+}
+
+// Runs given scenario in new world and returns its summary
+TSharedPtr<FJsonValue> UPoolManagerSoakCommandlet::RunScenario(const FPoolSoakScenario& Scenario)
+{
+	CreatePoolWorld();
+	UPoolManagerSubsystem& PoolManager = GetPoolManagerChecked();
+	PoolManager.ResetCounters();
+
+	const float DeltaSeconds = 1.f / FrameRate;
+	const int32 FramesNum = FMath::CeilToInt32(DurationSeconds * FrameRate);
+	const double BytesToMB = 1.0 / (1024.0 * 1024.0);
+
+	TArray<float> TimeUntilNextWave;
+	TimeUntilNextWave.SetNumZeroed(Scenario.Waves.Num());
+
+	// Taken objects with the time when they have to be returned
+	TArray<TPair<FPoolObjectHandle, double>> LiveObjects;
+	TArray<FPoolObjectHandle> TakenHandles;
+
+	TArray<double> FrameTimesMs;
+	FrameTimesMs.Reserve(FramesNum);
+	int32 MaxSpawnQueueNum = 0;
+	double PeakMemoryMB = 0.0;
+
+	FString Csv = TEXT("frame,time_s,frame_ms,spawn_queue,hits,misses,hit_rate,spawns,returns,memory_mb\n");
+	FPoolManagerCounters PrevCounters = PoolManager.GetCounters();
+
+	for (int32 FrameIndex = 0; FrameIndex < FramesNum; ++FrameIndex)
+	{
+		const double Time = FrameIndex * DeltaSeconds;
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+
+		// Return expired objects first, so they can be reused by new takes in the same frame
+		for (int32 Index = LiveObjects.Num() - 1; Index >= 0; --Index)
+		{
+			if (LiveObjects[Index].Value <= Time)
+			{
+				PoolManager.ReturnToPool(LiveObjects[Index].Key);
+				LiveObjects.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			}
+		}
+
+		for (int32 WaveIndex = 0; WaveIndex < Scenario.Waves.Num(); ++WaveIndex)
+		{
+			float& TimeUntilNext = TimeUntilNextWave[WaveIndex];
+			TimeUntilNext -= DeltaSeconds;
+			if (TimeUntilNext > 0.f)
+			{
+				continue;
+			}
+
+			const FPoolSoakWave& Wave = Scenario.Waves[WaveIndex];
+			TimeUntilNext += Wave.Interval;
+
+			const int32 Amount = FMath::RoundToInt32(Wave.Amount * Scale);
+			if (Amount <= 0)
+			{
+				continue;
+			}
+
+			TakenHandles.Reset();
+			PoolManager.TakeFromPoolArray(/*out*/ TakenHandles, Wave.ObjectClass, Amount, nullptr, Wave.Priority);
+			for (const FPoolObjectHandle& It : TakenHandles)
+			{
+				LiveObjects.Emplace(It, Time + Wave.Lifetime);
+			}
+		}
+
+		TickPoolWorld(DeltaSeconds);
+
+		const double FrameMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+		FrameTimesMs.Emplace(FrameMs);
+
+		const FPoolManagerCounters& Counters = PoolManager.GetCounters();
+		const FPoolManagerCounters FrameCounters = Counters - PrevCounters;
+		PrevCounters = Counters;
+
+		const int32 SpawnQueueNum = PoolManager.GetSpawnQueueNum();
+		MaxSpawnQueueNum = FMath::Max(MaxSpawnQueueNum, SpawnQueueNum);
+
+		const double MemoryMB = FPlatformMemory::GetStats().UsedPhysical * BytesToMB;
+		PeakMemoryMB = FMath::Max(PeakMemoryMB, MemoryMB);
+
+		Csv += FString::Printf(TEXT("%i,%.4f,%.4f,%i,%lld,%lld,%.4f,%lld,%lld,%.2f\n"),
+		                       FrameIndex, Time, FrameMs, SpawnQueueNum,
+		                       FrameCounters.HitsNum, FrameCounters.MissesNum, FrameCounters.GetHitRate(),
+		                       FrameCounters.SpawnsNum, FrameCounters.ReturnsNum, MemoryMB);
+	}
+
+	const FPoolManagerCounters TotalCounters = PoolManager.GetCounters();
+	DestroyPoolWorld();
+
+	const FString CsvPath = WriteTextReport(FString::Printf(TEXT("Soak_%s.csv"), *Scenario.Name), Csv);
+	if (CsvPath.IsEmpty())
+	{
+		UE_LOG(LogPoolManagerSoak, Error, TEXT("%s: failed to write the per-frame report"), *Scenario.Name);
+		return nullptr;
+	}
+
+	double TotalFrameMs = 0.0;
+	for (const double It : FrameTimesMs)
+	{
+		TotalFrameMs += It;
+	}
+	FrameTimesMs.Sort();
+	const int32 P99Index = FMath::Clamp(FMath::CeilToInt32(FrameTimesMs.Num() * 0.99) - 1, 0, FrameTimesMs.Num() - 1);
+
+	const TSharedRef<FJsonObject> Summary = MakeShared<FJsonObject>();
+	Summary->SetStringField(TEXT("name"), Scenario.Name);
+	Summary->SetNumberField(TEXT("frames"), FramesNum);
+	Summary->SetNumberField(TEXT("avg_frame_ms"), FramesNum > 0 ? TotalFrameMs / FramesNum : 0.0);
+	Summary->SetNumberField(TEXT("p99_frame_ms"), FrameTimesMs.IsValidIndex(P99Index) ? FrameTimesMs[P99Index] : 0.0);
+	Summary->SetNumberField(TEXT("max_frame_ms"), FrameTimesMs.IsEmpty() ? 0.0 : FrameTimesMs.Last());
+	Summary->SetNumberField(TEXT("hit_rate"), TotalCounters.GetHitRate());
+	Summary->SetNumberField(TEXT("spawns"), TotalCounters.SpawnsNum);
+	Summary->SetNumberField(TEXT("max_spawn_queue"), MaxSpawnQueueNum);
+	Summary->SetNumberField(TEXT("peak_memory_mb"), PeakMemoryMB);
+	Summary->SetStringField(TEXT("csv"), CsvPath);
+
+	UE_LOG(LogPoolManagerSoak, Display, TEXT("%s: %i frames, avg %.3f ms, max %.3f ms, hit rate %.3f, max spawn queue %i"),
+	       *Scenario.Name, FramesNum, Summary->GetNumberField(TEXT("avg_frame_ms")), Summary->GetNumberField(TEXT("max_frame_ms")),
+	       TotalCounters.GetHitRate(), MaxSpawnQueueNum);
+
+	return MakeShared<FJsonValueObject>(Summary);
+}
@@ -0,0 +1,114 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+// Pool Manager
+#include "PoolManagerBenchmarkCommandlet.h"
+#include "PoolManagerHeadlessWorld.h"
+#include "PoolManagerSubsystem.h"
+#include "Data/PoolObjectData.h"
+
+// UE
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Checks the behaviour of take, return, cancel, prewarm and empty operations of the Pool Manager.
+ * Can be run headless: UnrealEditor-Cmd <Project> -ExecCmds="Automation RunTests PoolManager; Quit" -nullrhi -unattended
+ */
+BEGIN_DEFINE_SPEC(FPoolManagerSpec, "PoolManager", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+	/** Is created anew for each test, so pools never leak between tests. */
+	UWorld* World = nullptr;
+
+	/** The Pool Manager of created world. */
+	UPoolManagerSubsystem* PoolManager = nullptr;
+
+	/** Is the lightweight pooled class. */
+	const UClass* ObjectClass = nullptr;
+
+	/** Ticks the world once, so spawn queues are processed. */
+	void TickWorld() const { FPoolManagerHeadlessWorld::Tick(*World, 1.f / 60.f); }
+END_DEFINE_SPEC(FPoolManagerSpec)
+
+void FPoolManagerSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		World = FPoolManagerHeadlessWorld::Create(TEXT("PoolManagerSpecWorld"));
+		PoolManager = World->GetSubsystem<UPoolManagerSubsystem>();
+		ObjectClass = UPoolBenchmarkObject::StaticClass();
+		checkf(PoolManager, TEXT("ERROR: [%i] %hs:\n'PoolManager' is not created for the world!"), __LINE__, __FUNCTION__);
+	});
+
+	AfterEach([this]()
+	{
+		FPoolManagerHeadlessWorld::Destroy(World);
+		World = nullptr;
+		PoolManager = nullptr;
+	});
+
+	Describe(TEXT("TakeFromPool"), [this]()
+	{
+		It(TEXT("should spawn active object immediately for critical request"), [this]()
+		{
+			const FPoolObjectHandle Handle = PoolManager->TakeFromPool(ObjectClass, FTransform::Identity, nullptr, ESpawnRequestPriority::Critical);
+			const UObject* TakenObject = PoolManager->FindPoolObjectByHandle(Handle).PoolObject;
+			TestNotNull(TEXT("Taken object"), TakenObject);
+			TestTrue(TEXT("Taken object is active"), PoolManager->IsActive(TakenObject));
+		});
+
+		It(TEXT("should reuse returned object"), [this]()
+		{
+			const FPoolObjectHandle Handle = PoolManager->TakeFromPool(ObjectClass, FTransform::Identity, nullptr, ESpawnRequestPriority::Critical);
+			const UObject* TakenObject = PoolManager->FindPoolObjectByHandle(Handle).PoolObject;
+			PoolManager->ReturnToPool(Handle);
+
+			const FPoolObjectHandle RetakenHandle = PoolManager->TakeFromPool(ObjectClass);
+			const UObject* RetakenObject = PoolManager->FindPoolObjectByHandle(RetakenHandle).PoolObject;
+			TestTrue(TEXT("Retaken object is the returned one"), TakenObject && RetakenObject == TakenObject);
+		});
+	});
+
+	Describe(TEXT("ReturnToPool"), [this]()
+	{
+		It(TEXT("should free taken object"), [this]()
+		{
+			const FPoolObjectHandle Handle = PoolManager->TakeFromPool(ObjectClass, FTransform::Identity, nullptr, ESpawnRequestPriority::Critical);
+			const UObject* TakenObject = PoolManager->FindPoolObjectByHandle(Handle).PoolObject;
+			TestTrue(TEXT("Returned"), PoolManager->ReturnToPool(Handle));
+			TestTrue(TEXT("Returned object is free"), PoolManager->IsFreeObjectInPool(TakenObject));
+		});
+
+		It(TEXT("should cancel queued request, so it is never spawned"), [this]()
+		{
+			const FPoolObjectHandle Handle = PoolManager->TakeFromPool(ObjectClass);
+			TestTrue(TEXT("Cancelled"), PoolManager->ReturnToPool(Handle));
+
+			TickWorld();
+			TickWorld();
+			TestEqual(TEXT("Registered objects"), PoolManager->GetRegisteredObjectsNum(ObjectClass), 0);
+		});
+	});
+
+	Describe(TEXT("PrewarmPool"), [this]()
+	{
+		It(TEXT("should fill the pool with free objects"), [this]()
+		{
+			constexpr int32 PoolSize = 10;
+			PoolManager->PrewarmPool(ObjectClass, PoolSize, ESpawnRequestPriority::Critical);
+			TestEqual(TEXT("Free objects"), PoolManager->GetFreeObjectsNum(ObjectClass), PoolSize);
+		});
+	});
+
+	Describe(TEXT("EmptyPool"), [this]()
+	{
+		It(TEXT("should remove all objects"), [this]()
+		{
+			PoolManager->PrewarmPool(ObjectClass, 10, ESpawnRequestPriority::Critical);
+			PoolManager->EmptyPool(ObjectClass);
+			TestEqual(TEXT("Registered objects"), PoolManager->GetRegisteredObjectsNum(ObjectClass), 0);
+		});
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
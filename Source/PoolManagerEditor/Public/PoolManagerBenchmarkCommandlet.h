@@ -0,0 +1,50 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "PoolManagerCommandletBase.h"
+
+#include "PoolManagerBenchmarkCommandlet.generated.h"
+
+class FJsonValue;
+
+/**
+ * Is the lightweight object used by the benchmark and automation tests, so measurements reflect the Pool Manager itself rather than the object.
+ */
+UCLASS(Transient)
+class POOLMANAGEREDITOR_API UPoolBenchmarkObject : public UObject
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Measures the cost of main Pool Manager operations on different pool sizes, e.g:
+ * UnrealEditor-Cmd <Project> -run=PoolManagerBenchmark -PoolSizes=10,1000,10000,100000 -OpsPerSample=10000 -MaxFrames=1000
+ * Writes results to 'Saved/PoolManager/Benchmark.json' and returns non-zero exit code if the report is not written.
+ * Behaviour of the operations is checked by automation tests instead: -ExecCmds="Automation RunTests PoolManager"
+ */
+UCLASS()
+class POOLMANAGEREDITOR_API UPoolManagerBenchmarkCommandlet : public UPoolManagerCommandletBase
+{
+	GENERATED_BODY()
+
+public:
+	/** Is overridden to run all benchmarks. */
+	virtual int32 Main(const FString& Params) override;
+
+protected:
+	/** Measures all operations on the pool of given size. */
+	virtual void RunSample(int32 PoolSize);
+
+	/** Adds the measurement to the report. */
+	void AddResult(int32 PoolSize, const TCHAR* Operation, int32 OpsNum, uint64 StartCycles);
+
+	/** Amount of operations measured per sample, is clamped by the pool size. */
+	int32 OpsPerSample = 10000;
+
+	/** Maximum amount of frames to tick while measuring spawn queue throughput. */
+	int32 MaxFrames = 1000;
+
+	/** Collected measurements. */
+	TArray<TSharedPtr<FJsonValue>> Results;
+};
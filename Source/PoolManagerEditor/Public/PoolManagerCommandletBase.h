@@ -0,0 +1,52 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+// UE
+#include "Commandlets/Commandlet.h"
+
+#include "PoolManagerCommandletBase.generated.h"
+
+class UPoolManagerSubsystem;
+class FJsonObject;
+
+/**
+ * Base class for headless commandlets that run workloads against the Pool Manager, e.g:
+ * UnrealEditor-Cmd <Project> -run=PoolManagerBenchmark -nullrhi -unattended
+ * Creates empty transient game world with its own Pool Manager, ticks it manually and writes JSON reports to 'Saved/PoolManager'.
+ */
+UCLASS(Abstract)
+class POOLMANAGEREDITOR_API UPoolManagerCommandletBase : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	/** Default constructor. */
+	UPoolManagerCommandletBase();
+
+protected:
+	/** Creates empty game world where objects are pooled, it is initialized for play, so timers and ticking work as in game. */
+	virtual UWorld* CreatePoolWorld();
+
+	/** Destroys the world created by CreatePoolWorld(). */
+	virtual void DestroyPoolWorld();
+
+	/** Ticks the world once, so spawn queues, timers and end of frame updates of the Pool Manager are processed. */
+	void TickPoolWorld(float DeltaSeconds);
+
+	/** Returns the Pool Manager of created world, crashes if the world is not created. */
+	UPoolManagerSubsystem& GetPoolManagerChecked() const;
+
+	/** Writes given text to 'Saved/PoolManager/<FileName>' and returns the full path or empty string on failure. */
+	static FString WriteTextReport(const FString& FileName, const FString& Text);
+
+	/** Writes given JSON object to 'Saved/PoolManager/<FileName>' and returns the full path or empty string on failure. */
+	static FString WriteJsonReport(const FString& FileName, const TSharedRef<FJsonObject>& JsonObject);
+
+	/** Parses comma separated integers from the command line, e.g: -PoolSizes=10,1000 */
+	static TArray<int32> ParseIntArray(const FString& Params, const TCHAR* Key, const TArray<int32>& DefaultValues);
+
+	/** The world created by CreatePoolWorld(). */
+	UPROPERTY(Transient)
+	TObjectPtr<UWorld> PoolWorld = nullptr;
+};
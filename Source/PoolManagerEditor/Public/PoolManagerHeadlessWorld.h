@@ -0,0 +1,24 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UWorld;
+
+/**
+ * Creates and ticks empty transient game worlds with their own Pool Manager without running the engine loop.
+ * Is shared by headless commandlets and automation tests of the Pool Manager.
+ */
+struct POOLMANAGEREDITOR_API FPoolManagerHeadlessWorld
+{
+	/** Creates empty game world where objects are pooled, it is initialized for play, so timers and ticking work as in game. */
+	static UWorld* Create(FName WorldName);
+
+	/** Destroys the world created by Create() and collects its garbage. */
+	static void Destroy(UWorld* World);
+
+	/** Ticks the world once, so spawn queues, timers and end of frame updates of the Pool Manager are processed.
+	 * Does not advance the global frame counter, so it is safe to be called many times within one frame of the editor. */
+	static void Tick(UWorld& World, float DeltaSeconds);
+};
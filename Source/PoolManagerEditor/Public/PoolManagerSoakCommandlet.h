@@ -0,0 +1,88 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+// Pool Manager
+#include "PoolManagerCommandletBase.h"
+#include "Data/SpawnRequestPriority.h"
+
+// UE
+#include "Blueprint/UserWidget.h"
+
+#include "PoolManagerSoakCommandlet.generated.h"
+
+class FJsonValue;
+
+/**
+ * Is the lightweight widget used by the soak commandlet to churn the widget pool.
+ */
+UCLASS(Transient)
+class POOLMANAGEREDITOR_API UPoolSoakWidget : public UUserWidget
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Describes objects that are periodically taken from the pool and returned after their lifetime.
+ */
+struct FPoolSoakWave
+{
+	/** Class of objects to take. */
+	const UClass* ObjectClass = nullptr;
+
+	/** Seconds between takes, is taken every frame if 0. */
+	float Interval = 0.f;
+
+	/** Amount of objects taken each time, is multiplied by -Scale. */
+	int32 Amount = 1;
+
+	/** Seconds after which taken objects are returned to the pool. */
+	float Lifetime = 1.f;
+
+	/** Priority of the take requests. */
+	ESpawnRequestPriority Priority = ESpawnRequestPriority::Normal;
+};
+
+/**
+ * Is the named set of waves that run together.
+ */
+struct FPoolSoakScenario
+{
+	/** Name of the scenario, is used in -Scenarios and report names. */
+	FString Name;
+
+	/** Waves of the scenario. */
+	TArray<FPoolSoakWave> Waves;
+};
+
+/**
+ * Runs game-like workloads against the Pool Manager for given time to catch frame-time regressions without game content, e.g:
+ * UnrealEditor-Cmd <Project> -run=PoolManagerSoak -Scenarios=BulletHell,SustainedFire,WaveClear,UIChurn -Minutes=10 -FrameRate=60 -Scale=1
+ * Each scenario writes per-frame 'Saved/PoolManager/Soak_<Scenario>.csv' (frame time, spawn queue depth, hit rate, memory),
+ * while 'Saved/PoolManager/Soak.json' contains the summary of all scenarios.
+ */
+UCLASS()
+class POOLMANAGEREDITOR_API UPoolManagerSoakCommandlet : public UPoolManagerCommandletBase
+{
+	GENERATED_BODY()
+
+public:
+	/** Is overridden to run all requested scenarios. */
+	virtual int32 Main(const FString& Params) override;
+
+protected:
+	/** Returns all known scenarios: bullet-hell burst, sustained fire, wave clear and UI churn. */
+	virtual void MakeScenarios(TArray<FPoolSoakScenario>& OutScenarios) const;
+
+	/** Runs given scenario in new world and returns its summary, or null if the report failed to be written. */
+	virtual TSharedPtr<FJsonValue> RunScenario(const FPoolSoakScenario& Scenario);
+
+	/** Duration of each scenario in seconds of simulated time. */
+	float DurationSeconds = 60.f;
+
+	/** Amount of simulated frames per second. */
+	float FrameRate = 60.f;
+
+	/** Multiplier of the amount of objects taken by each wave. */
+	float Scale = 1.f;
+};